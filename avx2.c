@@ -0,0 +1,302 @@
+/*
+
+AVX2 multi-block implementation of the Kalyna block cipher (DSTU 7624:2014)
+
+Blocks are processed in units of two YMM registers (64 bytes): four
+Kalyna-128 blocks, two Kalyna-256 blocks or one Kalyna-512 block. SubBytes
+gathers S-Box bytes, ShiftRows is a byte shuffle (across lanes and registers
+where the block requires it), MixColumns multiplies by the MDS coefficients
+with nibble-table byte shuffles and round keys are added with vector
+operations. Functions are compiled for AVX2 with target attributes and must
+only be called when KalynaCpuFeatures() reports support.
+
+Processors with GFNI run the same units with MixColumns done by
+gf2p8affineqb: multiplication by a constant of the Kalyna field is linear
+over GF(2), so it is an 8x8 bit matrix (GfniMatrix()) regardless of the
+reduction polynomial and no basis change is needed. The S-Boxes are not
+affine maps of the field inverse and keep using gathers.
+
+*/
+
+#include <pthread.h>
+
+#include "transformations.h"
+#include "tables.h"
+
+
+uint64_t GfniMatrix(uint8_t coefficient) {
+    int i, j;
+    uint64_t matrix = 0;
+    for (j = 0; j < 8; ++j) {
+        /* Column j: image of the basis element x^j. */
+        uint8_t image = MultiplyGF(coefficient, (uint8_t)(1 << j));
+        for (i = 0; i < 8; ++i) {
+            if ((image >> i) & 1)
+                matrix |= 1ULL << ((7 - i) * 8 + j);
+        }
+    }
+    return matrix;
+}
+
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+
+#define AVX2 __attribute__((target("avx2")))
+#define GFNI __attribute__((target("avx2,gfni")))
+
+#define kUNIT_BYTES 64
+#define kUNIT_WORDS (kUNIT_BYTES / sizeof(uint64_t))
+
+/*!
+ * Constants of one block size and direction: shuffle masks, MDS nibble
+ * tables and S-Boxes. Built once (Avx2Tables()); round keys are read from
+ * the schedule by the units (Avx2RoundKey()).
+ */
+typedef struct {
+    size_t nb;
+    __m256i shift_rows[2][2][2];  /* [output register][input register][lanes swapped] */
+    __m256i rotate[8];  /* Rotate bytes of every column by k rows. */
+    __m256i mds_low[8];
+    __m256i mds_high[8];
+    __m256i mds_affine[8];  /* GfniMatrix() of the coefficients. */
+    int mds_one[8];  /* Coefficient k of the first MDS row equals 1. */
+    int32_t sboxes[4 * 256];  /* S-Boxes widened for 32-bit gathers. */
+} avx2_ctx_t;
+
+
+static AVX2 void Avx2ShiftRowsMasks(avx2_ctx_t* a, int inverse) {
+    int o, q, p, col, row, from, shift;
+    uint8_t masks[2][2][2][32];
+
+    memset(masks, 0x80, sizeof(masks));
+    for (o = 0; o < 2; ++o) {
+        for (q = 0; q < 32; ++q) {
+            /* Position within the block of the output byte. */
+            p = (o * 32 + q) % (a->nb * sizeof(uint64_t));
+            col = p / sizeof(uint64_t);
+            row = p % sizeof(uint64_t);
+            shift = row * a->nb / sizeof(uint64_t);
+            from = inverse ? (col + shift) % a->nb : (col + a->nb - shift) % a->nb;
+            /* Same block, source column `from`. */
+            p = o * 32 + q - p + from * sizeof(uint64_t) + row;
+            masks[o][p / 32][(p % 32) / 16 != q / 16][q] = p % 16;
+        }
+    }
+    for (o = 0; o < 2; ++o) {
+        for (p = 0; p < 2; ++p) {
+            a->shift_rows[o][p][0] = _mm256_loadu_si256((const __m256i*)masks[o][p][0]);
+            a->shift_rows[o][p][1] = _mm256_loadu_si256((const __m256i*)masks[o][p][1]);
+        }
+    }
+}
+
+static AVX2 void Avx2Setup(avx2_ctx_t* a, size_t nb, uint8_t sboxes[4][256], uint8_t matrix[8][8],
+                           uint8_t nibbles[8][2][16], int inverse) {
+    int k, q;
+    uint8_t rotate[32];
+
+    a->nb = nb;
+    Avx2ShiftRowsMasks(a, inverse);
+    for (q = 0; q < 4 * 256; ++q) {
+        a->sboxes[q] = sboxes[q / 256][q % 256];
+    }
+    for (k = 0; k < 8; ++k) {
+        for (q = 0; q < 32; ++q) {
+            rotate[q] = (q % 16 & ~7) | ((q + k) & 7);
+        }
+        a->rotate[k] = _mm256_loadu_si256((const __m256i*)rotate);
+        a->mds_one[k] = matrix[0][k] == 1;
+        a->mds_low[k] = _mm256_loadu2_m128i((const __m128i*)nibbles[k][0], (const __m128i*)nibbles[k][0]);
+        a->mds_high[k] = _mm256_loadu2_m128i((const __m128i*)nibbles[k][1], (const __m128i*)nibbles[k][1]);
+        a->mds_affine[k] = _mm256_set1_epi64x((long long)GfniMatrix(matrix[0][k]));
+    }
+}
+
+/* [Nb 2, 4, 8][inverse] */
+static avx2_ctx_t avx2_tables[3][2];
+static pthread_once_t avx2_tables_once = PTHREAD_ONCE_INIT;
+
+static AVX2 void Avx2BuildTables(void) {
+    size_t i;
+    for (i = 0; i < 3; ++i) {
+        Avx2Setup(&avx2_tables[i][0], kNB_128 << i, sboxes_enc, mds_matrix, mds_nibbles_enc, FALSE);
+        Avx2Setup(&avx2_tables[i][1], kNB_128 << i, sboxes_dec, mds_inv_matrix, mds_nibbles_dec, TRUE);
+    }
+}
+
+static const avx2_ctx_t* Avx2Tables(size_t nb, int inverse) {
+    pthread_once(&avx2_tables_once, Avx2BuildTables);
+    return &avx2_tables[nb == kNB_128 ? 0 : nb == kNB_256 ? 1 : 2][inverse];
+}
+
+/*!
+ * Half `k` of round key `key` repeated over the unit: the 2 word key in
+ * both lanes, the 4 word key in each register, the 8 word key across both.
+ */
+static inline AVX2 __m256i Avx2RoundKey(const avx2_ctx_t* a, const uint64_t* key, int k) {
+    if (a->nb == kNB_128)
+        return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)key));
+    return _mm256_loadu_si256((const __m256i*)(key + (k * 4) % a->nb));
+}
+
+static inline AVX2 __m256i Avx2SubBytes(__m256i x, const int32_t* sboxes) {
+    const __m256i offsets = _mm256_setr_epi32(0, 256, 512, 768, 0, 256, 512, 768);
+    __m128i lo = _mm256_castsi256_si128(x);
+    __m128i hi = _mm256_extracti128_si256(x, 1);
+    __m256i s[4];
+
+    /* Byte position % 4 selects the S-Box. */
+    s[0] = _mm256_i32gather_epi32(sboxes, _mm256_add_epi32(_mm256_cvtepu8_epi32(lo), offsets), 4);
+    s[1] = _mm256_i32gather_epi32(sboxes, _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)), offsets), 4);
+    s[2] = _mm256_i32gather_epi32(sboxes, _mm256_add_epi32(_mm256_cvtepu8_epi32(hi), offsets), 4);
+    s[3] = _mm256_i32gather_epi32(sboxes, _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)), offsets), 4);
+    x = _mm256_packus_epi16(_mm256_packus_epi32(s[0], s[1]), _mm256_packus_epi32(s[2], s[3]));
+    return _mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+static inline AVX2 void Avx2ShiftRows(const avx2_ctx_t* a, __m256i* x) {
+    int o, i;
+    __m256i in[2], swapped[2], out[2];
+
+    in[0] = x[0];
+    in[1] = x[1];
+    if (a->nb == kNB_128) {
+        /* Each lane is a block. */
+        x[0] = _mm256_shuffle_epi8(in[0], a->shift_rows[0][0][0]);
+        x[1] = _mm256_shuffle_epi8(in[1], a->shift_rows[1][1][0]);
+        return;
+    }
+    swapped[0] = _mm256_permute2x128_si256(in[0], in[0], 0x01);
+    swapped[1] = _mm256_permute2x128_si256(in[1], in[1], 0x01);
+    for (o = 0; o < 2; ++o) {
+        if (a->nb == kNB_256) {
+            /* Each register is a block. */
+            out[o] = _mm256_or_si256(_mm256_shuffle_epi8(in[o], a->shift_rows[o][o][0]),
+                                     _mm256_shuffle_epi8(swapped[o], a->shift_rows[o][o][1]));
+        } else {
+            out[o] = _mm256_setzero_si256();
+            for (i = 0; i < 2; ++i) {
+                out[o] = _mm256_or_si256(out[o], _mm256_shuffle_epi8(in[i], a->shift_rows[o][i][0]));
+                out[o] = _mm256_or_si256(out[o], _mm256_shuffle_epi8(swapped[i], a->shift_rows[o][i][1]));
+            }
+        }
+    }
+    x[0] = out[0];
+    x[1] = out[1];
+}
+
+/*!
+ * Multiply every column by the circulant MDS matrix:
+ * out[row] = XOR_k matrix[0][k] * in[(row + k) % 8].
+ */
+static inline AVX2 __m256i Avx2MixColumns(const avx2_ctx_t* a, __m256i x) {
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    __m256i lo = _mm256_and_si256(x, nibble_mask);
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble_mask);
+    __m256i product;
+    __m256i result = _mm256_setzero_si256();
+    int k;
+
+    for (k = 0; k < 8; ++k) {
+        if (a->mds_one[k])
+            product = x;
+        else
+            product = _mm256_xor_si256(_mm256_shuffle_epi8(a->mds_low[k], lo),
+                                       _mm256_shuffle_epi8(a->mds_high[k], hi));
+        result = _mm256_xor_si256(result, k == 0 ? product : _mm256_shuffle_epi8(product, a->rotate[k]));
+    }
+    return result;
+}
+
+/*!
+ * Multiply every column by the circulant MDS matrix with one affine
+ * transformation per coefficient (see GfniMatrix()).
+ */
+static inline GFNI __m256i GfniMixColumns(const avx2_ctx_t* a, __m256i x) {
+    __m256i product;
+    __m256i result = _mm256_setzero_si256();
+    int k;
+
+    for (k = 0; k < 8; ++k) {
+        product = a->mds_one[k] ? x : _mm256_gf2p8affine_epi64_epi8(x, a->mds_affine[k], 0);
+        result = _mm256_xor_si256(result, k == 0 ? product : _mm256_shuffle_epi8(product, a->rotate[k]));
+    }
+    return result;
+}
+
+#define UNIT_CAT2(prefix, name) prefix ## name
+#define UNIT_CAT(prefix, name) UNIT_CAT2(prefix, name)
+#define UNIT(name) UNIT_CAT(UNIT_PREFIX, name)
+
+#define UNIT_PREFIX Avx2
+#define UNIT_TARGET AVX2
+#include "avx2_template.h"
+#undef UNIT_PREFIX
+#undef UNIT_TARGET
+
+#define UNIT_PREFIX Gfni
+#define UNIT_TARGET GFNI
+#include "avx2_template.h"
+#undef UNIT_PREFIX
+#undef UNIT_TARGET
+
+/*!
+ * Run `unit` over all whole units and a zero padded last one.
+ */
+static void Avx2Blocks(const avx2_ctx_t* a, const kalyna_schedule_t* schedule,
+                       void (*unit)(const avx2_ctx_t*, const kalyna_schedule_t*, const uint64_t*, uint64_t*),
+                       const uint64_t* in, uint64_t* out, size_t nblocks) {
+    size_t words = nblocks * a->nb;
+    uint64_t buffer[kUNIT_WORDS];
+
+    for (; words >= kUNIT_WORDS; words -= kUNIT_WORDS) {
+        unit(a, schedule, in, out);
+        in += kUNIT_WORDS;
+        out += kUNIT_WORDS;
+    }
+    if (words > 0) {
+        memset(buffer, 0, sizeof(buffer));
+        memcpy(buffer, in, words * sizeof(uint64_t));
+        unit(a, schedule, buffer, buffer);
+        memcpy(out, buffer, words * sizeof(uint64_t));
+        SecureZero(buffer, sizeof(buffer));
+    }
+}
+
+void Avx2EncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule, uint64_t* ciphertext, size_t nblocks) {
+    Avx2Blocks(Avx2Tables(schedule->nb, FALSE), schedule, Avx2EncipherUnit, plaintext, ciphertext, nblocks);
+}
+
+void Avx2DecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule, uint64_t* plaintext, size_t nblocks) {
+    Avx2Blocks(Avx2Tables(schedule->nb, TRUE), schedule, Avx2DecipherUnit, ciphertext, plaintext, nblocks);
+}
+
+void GfniEncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule, uint64_t* ciphertext, size_t nblocks) {
+    Avx2Blocks(Avx2Tables(schedule->nb, FALSE), schedule, GfniEncipherUnit, plaintext, ciphertext, nblocks);
+}
+
+void GfniDecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule, uint64_t* plaintext, size_t nblocks) {
+    Avx2Blocks(Avx2Tables(schedule->nb, TRUE), schedule, GfniDecipherUnit, ciphertext, plaintext, nblocks);
+}
+
+#else
+
+void Avx2EncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule, uint64_t* ciphertext, size_t nblocks) {
+    ScheduleEncipherBlocks(plaintext, schedule, ciphertext, nblocks);
+}
+
+void Avx2DecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule, uint64_t* plaintext, size_t nblocks) {
+    ScheduleDecipherBlocks(ciphertext, schedule, plaintext, nblocks);
+}
+
+void GfniEncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule, uint64_t* ciphertext, size_t nblocks) {
+    ScheduleEncipherBlocks(plaintext, schedule, ciphertext, nblocks);
+}
+
+void GfniDecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule, uint64_t* plaintext, size_t nblocks) {
+    ScheduleDecipherBlocks(ciphertext, schedule, plaintext, nblocks);
+}
+
+#endif
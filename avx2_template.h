@@ -0,0 +1,60 @@
+/*
+
+Template of the 64-byte unit functions of the AVX2 implementation of the
+Kalyna block cipher (DSTU 7624:2014)
+
+Included by avx2.c once per MixColumns flavour with UNIT(name) (prefixed
+function name) and UNIT_TARGET (target attribute) defined. UNIT(MixColumns)
+must be defined before inclusion.
+
+*/
+
+static UNIT_TARGET void UNIT(EncipherUnit)(const avx2_ctx_t* a, const kalyna_schedule_t* schedule, const uint64_t* in,
+                                           uint64_t* out) {
+    size_t round, nr = schedule->nr;
+    const uint64_t* keys = schedule->round_keys;
+    __m256i x[2];
+
+    x[0] = _mm256_add_epi64(_mm256_loadu_si256((const __m256i*)in), Avx2RoundKey(a, keys, 0));
+    x[1] = _mm256_add_epi64(_mm256_loadu_si256((const __m256i*)in + 1), Avx2RoundKey(a, keys, 1));
+    for (round = 1; round <= nr; ++round) {
+        x[0] = Avx2SubBytes(x[0], a->sboxes);
+        x[1] = Avx2SubBytes(x[1], a->sboxes);
+        Avx2ShiftRows(a, x);
+        x[0] = UNIT(MixColumns)(a, x[0]);
+        x[1] = UNIT(MixColumns)(a, x[1]);
+        if (round < nr) {
+            x[0] = _mm256_xor_si256(x[0], Avx2RoundKey(a, keys + round * a->nb, 0));
+            x[1] = _mm256_xor_si256(x[1], Avx2RoundKey(a, keys + round * a->nb, 1));
+        }
+    }
+    x[0] = _mm256_add_epi64(x[0], Avx2RoundKey(a, keys + nr * a->nb, 0));
+    x[1] = _mm256_add_epi64(x[1], Avx2RoundKey(a, keys + nr * a->nb, 1));
+    _mm256_storeu_si256((__m256i*)out, x[0]);
+    _mm256_storeu_si256((__m256i*)out + 1, x[1]);
+}
+
+static UNIT_TARGET void UNIT(DecipherUnit)(const avx2_ctx_t* a, const kalyna_schedule_t* schedule, const uint64_t* in,
+                                           uint64_t* out) {
+    size_t round, nr = schedule->nr;
+    const uint64_t* keys = schedule->round_keys;
+    __m256i x[2];
+
+    x[0] = _mm256_sub_epi64(_mm256_loadu_si256((const __m256i*)in), Avx2RoundKey(a, keys + nr * a->nb, 0));
+    x[1] = _mm256_sub_epi64(_mm256_loadu_si256((const __m256i*)in + 1), Avx2RoundKey(a, keys + nr * a->nb, 1));
+    for (round = nr; round > 0; --round) {
+        x[0] = UNIT(MixColumns)(a, x[0]);
+        x[1] = UNIT(MixColumns)(a, x[1]);
+        Avx2ShiftRows(a, x);
+        x[0] = Avx2SubBytes(x[0], a->sboxes);
+        x[1] = Avx2SubBytes(x[1], a->sboxes);
+        if (round > 1) {
+            x[0] = _mm256_xor_si256(x[0], Avx2RoundKey(a, keys + (round - 1) * a->nb, 0));
+            x[1] = _mm256_xor_si256(x[1], Avx2RoundKey(a, keys + (round - 1) * a->nb, 1));
+        }
+    }
+    x[0] = _mm256_sub_epi64(x[0], Avx2RoundKey(a, keys, 0));
+    x[1] = _mm256_sub_epi64(x[1], Avx2RoundKey(a, keys, 1));
+    _mm256_storeu_si256((__m256i*)out, x[0]);
+    _mm256_storeu_si256((__m256i*)out + 1, x[1]);
+}
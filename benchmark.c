@@ -2,10 +2,58 @@
 #include <stdlib.h>
 #include <time.h>
 #include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
 #include "kalyna.h"
+#include "transformations.h"
 
 #define BENCHMARK_ITERATIONS 100000
 #define WARMUP_ITERATIONS 1000
+#define BULK_BLOCKS 1024
+#define BULK_ITERATIONS (BENCHMARK_ITERATIONS / BULK_BLOCKS)
+#define KEY_CONTEXTS 256
+#define KEY_ITERATIONS 200
+#define CACHE_TENANTS 2048
+#define CACHE_REQUESTS 1000000
+#define ROTATION_READERS 4
+#define ROTATION_REQUESTS 1000000
+#define SNAPSHOT_SCHEDULES 20000
+#define STORE_KEYS 1000
+#define STORE_WORKERS 32
+#define POOL_CONTEXTS 64
+#define SEEK_READS 10000
+#define SEEK_READ_BYTES 4096
+#define CBC_RECORDS 4096
+#define CBC_RECORD_BLOCKS 64
+#define POOL_ROUNDS 2000
+
+#ifdef KALYNA_COUNT_ALLOCS
+// Heap allocations are counted by wrapping the allocator at link time
+// (-Wl,--wrap=malloc etc.), see the benchmark target in the makefile.
+static size_t alloc_count = 0;
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t nmemb, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    alloc_count++;
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t nmemb, size_t size) {
+    alloc_count++;
+    return __real_calloc(nmemb, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    alloc_count++;
+    return __real_realloc(ptr, size);
+}
+#endif
 
 typedef struct {
     const char* name;
@@ -44,9 +92,15 @@ void benchmark_variant(BenchmarkConfig config) {
     }
 
     // Key expansion (done once)
+#ifdef KALYNA_COUNT_ALLOCS
+    size_t key_exp_allocs = alloc_count;
+#endif
     double key_exp_start = get_time_ms();
     KalynaKeyExpand(key, ctx);
     double key_exp_time = get_time_ms() - key_exp_start;
+#ifdef KALYNA_COUNT_ALLOCS
+    key_exp_allocs = alloc_count - key_exp_allocs;
+#endif
 
     // Warmup
     for (int i = 0; i < WARMUP_ITERATIONS; i++) {
@@ -55,18 +109,109 @@ void benchmark_variant(BenchmarkConfig config) {
     }
 
     // Benchmark encryption
+#ifdef KALYNA_COUNT_ALLOCS
+    size_t enc_allocs = alloc_count;
+#endif
     double enc_start = get_time_ms();
     for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
         KalynaEncipher(plaintext, ctx, ciphertext);
     }
     double enc_time = get_time_ms() - enc_start;
+#ifdef KALYNA_COUNT_ALLOCS
+    enc_allocs = alloc_count - enc_allocs;
+#endif
 
     // Benchmark decryption
+#ifdef KALYNA_COUNT_ALLOCS
+    size_t dec_allocs = alloc_count;
+#endif
     double dec_start = get_time_ms();
     for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
         KalynaDecipher(ciphertext, ctx, decrypted);
     }
     double dec_time = get_time_ms() - dec_start;
+#ifdef KALYNA_COUNT_ALLOCS
+    dec_allocs = alloc_count - dec_allocs;
+#endif
+
+    // Benchmark bitsliced bulk encryption
+    uint64_t* bulk = (uint64_t*)calloc(BULK_BLOCKS * block_words, sizeof(uint64_t));
+    double bs_start = get_time_ms();
+    for (int i = 0; i < BULK_ITERATIONS; i++) {
+        KalynaBitslicedEncipher(bulk, ctx, bulk, BULK_BLOCKS);
+    }
+    double bs_time = get_time_ms() - bs_start;
+
+    // Benchmark multi-block encryption
+    double mb_start = get_time_ms();
+    for (int i = 0; i < BULK_ITERATIONS; i++) {
+        KalynaEncipherBlocks(bulk, ctx, bulk, BULK_BLOCKS);
+    }
+    double mb_time = get_time_ms() - mb_start;
+    double mb_dec_start = get_time_ms();
+    for (int i = 0; i < BULK_ITERATIONS; i++) {
+        KalynaDecipherBlocks(bulk, ctx, bulk, BULK_BLOCKS);
+    }
+    double mb_dec_time = get_time_ms() - mb_dec_start;
+
+    // Benchmark CTR mode on messages of the same size
+    double ctr_start = get_time_ms();
+    for (int i = 0; i < BULK_ITERATIONS; i++) {
+        KalynaCtrCrypt((uint8_t*)bulk, ctx, plaintext, (uint8_t*)bulk, BULK_BLOCKS * block_words * sizeof(uint64_t));
+    }
+    double ctr_time = get_time_ms() - ctr_start;
+
+    // Random reads of a 1 GiB CTR stream at unaligned offsets
+    uint64_t seek_seed = 1;
+    double seek_start = get_time_ms();
+    for (int i = 0; i < SEEK_READS; i++) {
+        seek_seed = seek_seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        KalynaCtrCryptAt((uint8_t*)bulk, ctx, plaintext, (seek_seed >> 34), (uint8_t*)bulk, SEEK_READ_BYTES);
+    }
+    double seek_time = get_time_ms() - seek_start;
+
+    // Benchmark CBC mode: serial enciphering, batched deciphering
+    double cbc_enc_start = get_time_ms();
+    for (int i = 0; i < BULK_ITERATIONS; i++) {
+        KalynaCbcEncipher(bulk, ctx, plaintext, bulk, BULK_BLOCKS);
+    }
+    double cbc_enc_time = get_time_ms() - cbc_enc_start;
+    double cbc_dec_start = get_time_ms();
+    for (int i = 0; i < BULK_ITERATIONS; i++) {
+        KalynaCbcDecipher(bulk, ctx, plaintext, bulk, BULK_BLOCKS);
+    }
+    double cbc_dec_time = get_time_ms() - cbc_dec_start;
+    free(bulk);
+
+    // Context in caller storage
+#ifdef KALYNA_COUNT_ALLOCS
+    size_t buffer_allocs = alloc_count;
+#endif
+    uint64_t storage[4096 / sizeof(uint64_t)];
+    kalyna_t* buffer_ctx = KalynaInitBuffer(storage, sizeof(storage), config.block_size, config.key_size);
+    if (buffer_ctx) {
+        KalynaKeyExpand(key, buffer_ctx);
+        KalynaDelete(buffer_ctx);
+    }
+#ifdef KALYNA_COUNT_ALLOCS
+    buffer_allocs = alloc_count - buffer_allocs;
+#endif
+
+    // Compact schedule, even round keys only
+    uint64_t compact_storage[2048 / sizeof(uint64_t)];
+    kalyna_schedule_t* compact = KalynaCompactScheduleInit(compact_storage, sizeof(compact_storage),
+                                                           config.block_size, config.key_size, key);
+    double compact_enc_start = get_time_ms();
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        KalynaScheduleEncipher(plaintext, compact, ciphertext);
+    }
+    double compact_enc_time = get_time_ms() - compact_enc_start;
+    double compact_dec_start = get_time_ms();
+    for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+        KalynaScheduleDecipher(ciphertext, compact, decrypted);
+    }
+    double compact_dec_time = get_time_ms() - compact_dec_start;
+    KalynaCompactScheduleWipe(compact);
 
     // Verify correctness
     if (memcmp(plaintext, decrypted, block_words * sizeof(uint64_t)) != 0) {
@@ -78,6 +223,13 @@ void benchmark_variant(BenchmarkConfig config) {
     double dec_ops_per_sec = (BENCHMARK_ITERATIONS * 1000.0) / dec_time;
     double enc_mb_per_sec = (enc_ops_per_sec * config.block_size) / (8.0 * 1024 * 1024);
     double dec_mb_per_sec = (dec_ops_per_sec * config.block_size) / (8.0 * 1024 * 1024);
+    double bs_blocks = (double)BULK_ITERATIONS * BULK_BLOCKS;
+    double bs_mb_per_sec = (bs_blocks * 1000.0 / bs_time * config.block_size) / (8.0 * 1024 * 1024);
+    double mb_mb_per_sec = (bs_blocks * 1000.0 / mb_time * config.block_size) / (8.0 * 1024 * 1024);
+    double mb_dec_mb_per_sec = (bs_blocks * 1000.0 / mb_dec_time * config.block_size) / (8.0 * 1024 * 1024);
+    double ctr_mb_per_sec = (bs_blocks * 1000.0 / ctr_time * config.block_size) / (8.0 * 1024 * 1024);
+    double cbc_enc_mb_per_sec = (bs_blocks * 1000.0 / cbc_enc_time * config.block_size) / (8.0 * 1024 * 1024);
+    double cbc_dec_mb_per_sec = (bs_blocks * 1000.0 / cbc_dec_time * config.block_size) / (8.0 * 1024 * 1024);
 
     // Print results
     printf("\n=== %s ===\n", config.name);
@@ -98,6 +250,42 @@ void benchmark_variant(BenchmarkConfig config) {
     printf("  Throughput:   %.2f ops/sec\n", dec_ops_per_sec);
     printf("  Throughput:   %.2f MB/s\n", dec_mb_per_sec);
 
+    printf("\nBitsliced encryption (%d-block calls):\n", BULK_BLOCKS);
+    printf("  Time/block:   %.3f µs\n", (bs_time * 1000) / bs_blocks);
+    printf("  Throughput:   %.2f MB/s\n", bs_mb_per_sec);
+
+    printf("\nMulti-block encryption (%d-block calls, backend %s):\n", BULK_BLOCKS,
+           KalynaBackendName(ctx->backend));
+    printf("  Time/block:   %.3f µs\n", (mb_time * 1000) / bs_blocks);
+    printf("  Throughput:   %.2f MB/s\n", mb_mb_per_sec);
+
+    printf("\nMulti-block decryption (%d-block calls):\n", BULK_BLOCKS);
+    printf("  Time/block:   %.3f µs\n", (mb_dec_time * 1000) / bs_blocks);
+    printf("  Throughput:   %.2f MB/s\n", mb_dec_mb_per_sec);
+
+    printf("\nCTR mode (%d-block messages):\n", BULK_BLOCKS);
+    printf("  Time/block:   %.3f µs\n", (ctr_time * 1000) / bs_blocks);
+    printf("  Throughput:   %.2f MB/s\n", ctr_mb_per_sec);
+    printf("  Random %d-byte reads: %.3f µs each\n", SEEK_READ_BYTES, (seek_time * 1000) / SEEK_READS);
+
+    printf("\nCBC mode (%d-block messages):\n", BULK_BLOCKS);
+    printf("  Encryption:   %.2f MB/s (serial)\n", cbc_enc_mb_per_sec);
+    printf("  Decryption:   %.2f MB/s (batched)\n", cbc_dec_mb_per_sec);
+
+    printf("\nCompact schedule (%zu bytes, context %zu bytes):\n",
+           KalynaCompactScheduleSize(config.block_size, config.key_size),
+           KalynaContextSize(config.block_size, config.key_size));
+    printf("  Encryption:   %.3f µs\n", (compact_enc_time * 1000) / BENCHMARK_ITERATIONS);
+    printf("  Decryption:   %.3f µs\n", (compact_dec_time * 1000) / BENCHMARK_ITERATIONS);
+
+#ifdef KALYNA_COUNT_ALLOCS
+    printf("\nHeap allocations:\n");
+    printf("  Key expansion: %zu\n", key_exp_allocs);
+    printf("  Encryption:    %.2f per block\n", (double)enc_allocs / BENCHMARK_ITERATIONS);
+    printf("  Decryption:    %.2f per block\n", (double)dec_allocs / BENCHMARK_ITERATIONS);
+    printf("  Buffer init:   %zu (KalynaInitBuffer + key expansion)\n", buffer_allocs);
+#endif
+
     // Cleanup
     free(key);
     free(plaintext);
@@ -106,6 +294,390 @@ void benchmark_variant(BenchmarkConfig config) {
     KalynaDelete(ctx);
 }
 
+void benchmark_key_expansion(BenchmarkConfig config) {
+    kalyna_t* ctxs[KEY_CONTEXTS];
+    size_t key_words = config.key_size / 64;
+    uint64_t* keys = (uint64_t*)calloc(KEY_CONTEXTS * key_words, sizeof(uint64_t));
+
+    for (size_t i = 0; i < KEY_CONTEXTS * key_words; i++) {
+        keys[i] = 0x0706050403020100ULL * (i + 1);
+    }
+    for (size_t i = 0; i < KEY_CONTEXTS; i++) {
+        ctxs[i] = KalynaInit(config.block_size, config.key_size);
+    }
+
+    double single_start = get_time_ms();
+    for (int n = 0; n < KEY_ITERATIONS; n++) {
+        for (size_t i = 0; i < KEY_CONTEXTS; i++) {
+            KalynaKeyExpand(keys + i * key_words, ctxs[i]);
+        }
+    }
+    double single_time = get_time_ms() - single_start;
+
+    double batch_start = get_time_ms();
+    for (int n = 0; n < KEY_ITERATIONS; n++) {
+        KalynaKeyExpandBatch(keys, ctxs, KEY_CONTEXTS);
+    }
+    double batch_time = get_time_ms() - batch_start;
+
+    double expansions = (double)KEY_ITERATIONS * KEY_CONTEXTS;
+    printf("\nKey expansion (%d keys per batch):\n", KEY_CONTEXTS);
+    printf("  Single:       %.2f keys/sec (%.3f µs/key)\n", expansions * 1000.0 / single_time,
+           single_time * 1000.0 / expansions);
+    printf("  Batched:      %.2f keys/sec (%.3f µs/key)\n", expansions * 1000.0 / batch_time,
+           batch_time * 1000.0 / expansions);
+
+    /* Per-packet keys: key setup plus one block. */
+    uint64_t block[8] = {0};
+    double expand_start = get_time_ms();
+    for (int n = 0; n < KEY_ITERATIONS; n++) {
+        for (size_t i = 0; i < KEY_CONTEXTS; i++) {
+            KalynaKeyExpand(keys + i * key_words, ctxs[0]);
+            KalynaEncipher(block, ctxs[0], block);
+        }
+    }
+    double expand_time = get_time_ms() - expand_start;
+
+    double once_start = get_time_ms();
+    for (int n = 0; n < KEY_ITERATIONS; n++) {
+        for (size_t i = 0; i < KEY_CONTEXTS; i++) {
+            KalynaEncipherOneShot(config.block_size, config.key_size, keys + i * key_words, block, block, 1);
+        }
+    }
+    double once_time = get_time_ms() - once_start;
+
+    printf("Key setup + one block:\n");
+    printf("  Expand:       %.2f keys/sec (%.3f µs/key)\n", expansions * 1000.0 / expand_time,
+           expand_time * 1000.0 / expansions);
+    printf("  One-shot:     %.2f keys/sec (%.3f µs/key)\n", expansions * 1000.0 / once_time,
+           once_time * 1000.0 / expansions);
+
+    for (size_t i = 0; i < KEY_CONTEXTS; i++) {
+        KalynaDelete(ctxs[i]);
+    }
+    free(keys);
+}
+
+void benchmark_cache(void) {
+    // Requests for random tenant keys, all fitting in the cache
+    uint64_t* keys = (uint64_t*)calloc(CACHE_TENANTS * 2, sizeof(uint64_t));
+    uint64_t block[2] = {0};
+    uint64_t seed = 1;
+    for (size_t i = 0; i < CACHE_TENANTS * 2; i++) {
+        keys[i] = 0x0706050403020100ULL * (i + 1);
+    }
+    kalyna_cache_t* cache = KalynaCacheCreate(CACHE_TENANTS);
+
+    double direct_start = get_time_ms();
+    for (int n = 0; n < CACHE_REQUESTS; n++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        kalyna_t* ctx = KalynaInit(128, 128);
+        KalynaKeyExpand(keys + (seed >> 33) % CACHE_TENANTS * 2, ctx);
+        KalynaEncipher(block, ctx, block);
+        KalynaDelete(ctx);
+    }
+    double direct_time = get_time_ms() - direct_start;
+
+    double cache_start = get_time_ms();
+    for (int n = 0; n < CACHE_REQUESTS; n++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const kalyna_schedule_t* schedule = KalynaCacheAcquire(cache, 128, 128, keys + (seed >> 33) % CACHE_TENANTS * 2);
+        KalynaScheduleEncipher(block, schedule, block);
+        KalynaCacheRelease(cache, schedule);
+    }
+    double cache_time = get_time_ms() - cache_start;
+
+    kalyna_cache_stats_t stats;
+    KalynaCacheStats(cache, &stats);
+    printf("\n=== Schedule cache (Kalyna-128/128, %d tenant keys) ===\n", CACHE_TENANTS);
+    printf("  Init + expand: %.3f µs/request\n", direct_time * 1000.0 / CACHE_REQUESTS);
+    printf("  Cache:         %.3f µs/request (%llu hits, %llu misses)\n", cache_time * 1000.0 / CACHE_REQUESTS,
+           (unsigned long long)stats.hits, (unsigned long long)stats.misses);
+
+    KalynaCacheDestroy(cache);
+    free(keys);
+}
+
+// Readers of a rotating key, guarded by a mutex or through the registry
+typedef struct {
+    pthread_mutex_t lock;
+    kalyna_t* ctx;
+    kalyna_registry_t* registry;
+    size_t reader;
+    atomic_int* done;
+} rotation_job_t;
+
+static void* mutex_reader(void* arg) {
+    rotation_job_t* job = (rotation_job_t*)arg;
+    uint64_t block[2] = {0};
+    for (int n = 0; n < ROTATION_REQUESTS; n++) {
+        pthread_mutex_lock(&job->lock);
+        KalynaEncipher(block, job->ctx, block);
+        pthread_mutex_unlock(&job->lock);
+    }
+    atomic_fetch_add(job->done, 1);
+    return NULL;
+}
+
+static void* registry_reader(void* arg) {
+    rotation_job_t* job = (rotation_job_t*)arg;
+    uint64_t block[2] = {0};
+    for (int n = 0; n < ROTATION_REQUESTS; n++) {
+        const kalyna_schedule_t* schedule = KalynaRegistryEnter(job->registry, job->reader);
+        KalynaScheduleEncipher(block, schedule, block);
+        KalynaRegistryExit(job->registry, job->reader);
+    }
+    atomic_fetch_add(job->done, 1);
+    return NULL;
+}
+
+static double run_rotation(rotation_job_t* shared, void* (*reader)(void*), size_t* rotations) {
+    pthread_t threads[ROTATION_READERS];
+    rotation_job_t jobs[ROTATION_READERS];
+    uint64_t key[2] = {0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL};
+    atomic_int done = 0;
+    double start = get_time_ms();
+    for (size_t i = 0; i < ROTATION_READERS; i++) {
+        jobs[i] = *shared;
+        jobs[i].reader = i;
+        jobs[i].done = &done;
+        pthread_create(&threads[i], NULL, reader, &jobs[i]);
+    }
+    // Rotate keys in the main thread until the readers are done
+    *rotations = 0;
+    while (atomic_load(&done) < ROTATION_READERS) {
+        key[0]++;
+        if (shared->registry) {
+            KalynaRegistryRotate(shared->registry, key);
+        } else {
+            pthread_mutex_lock(&shared->lock);
+            KalynaKeyExpand(key, shared->ctx);
+            pthread_mutex_unlock(&shared->lock);
+        }
+        ++*rotations;
+    }
+    for (size_t i = 0; i < ROTATION_READERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    return get_time_ms() - start;
+}
+
+void benchmark_registry(void) {
+    uint64_t key[2] = {0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL};
+    rotation_job_t shared;
+    size_t mutex_rotations, registry_rotations;
+    double requests = (double)ROTATION_READERS * ROTATION_REQUESTS;
+
+    memset(&shared, 0, sizeof(shared));
+    pthread_mutex_init(&shared.lock, NULL);
+    shared.ctx = KalynaInit(128, 128);
+    KalynaKeyExpand(key, shared.ctx);
+    double mutex_time = run_rotation(&shared, mutex_reader, &mutex_rotations);
+    KalynaDelete(shared.ctx);
+    shared.ctx = NULL;
+
+    shared.registry = KalynaRegistryCreate(128, 128, key, ROTATION_READERS);
+    double registry_time = run_rotation(&shared, registry_reader, &registry_rotations);
+    KalynaRegistryDestroy(shared.registry);
+    pthread_mutex_destroy(&shared.lock);
+
+    printf("\n=== Key rotation (Kalyna-128/128, %d reader threads) ===\n", ROTATION_READERS);
+    printf("  Mutex:         %.2f blocks/sec (%zu rotations)\n", requests * 1000.0 / mutex_time, mutex_rotations);
+    printf("  Registry:      %.2f blocks/sec (%zu rotations)\n", requests * 1000.0 / registry_time,
+           registry_rotations);
+}
+
+void benchmark_snapshot(void) {
+    kalyna_t** ctxs = (kalyna_t**)calloc(SNAPSHOT_SCHEDULES, sizeof(kalyna_t*));
+    const kalyna_schedule_t** schedules = (const kalyna_schedule_t**)calloc(SNAPSHOT_SCHEDULES, sizeof(*schedules));
+    kalyna_schedule_t* opened = (kalyna_schedule_t*)calloc(SNAPSHOT_SCHEDULES, sizeof(kalyna_schedule_t));
+    uint64_t key[4] = {0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL, 0x1716151413121110ULL, 0x1f1e1d1c1b1a1918ULL};
+    char path[] = "/tmp/kalyna-snapshot-XXXXXX";
+
+    // Cold start without a snapshot: expand every key
+    double expand_start = get_time_ms();
+    for (size_t i = 0; i < SNAPSHOT_SCHEDULES; i++) {
+        key[0] = i;
+        ctxs[i] = KalynaInit(256, 256);
+        KalynaKeyExpand(key, ctxs[i]);
+        schedules[i] = KalynaGetSchedule(ctxs[i]);
+    }
+    double expand_time = get_time_ms() - expand_start;
+
+    size_t size = KalynaSnapshotSize(schedules, SNAPSHOT_SCHEDULES);
+    void* buffer = malloc(size);
+    int fd = mkstemp(path);
+    if (fd < 0 || KalynaSnapshotWrite(schedules, SNAPSHOT_SCHEDULES, buffer, size) != 0 ||
+            write(fd, buffer, size) != (ssize_t)size) {
+        fprintf(stderr, "ERROR: could not write snapshot\n");
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+
+    // Cold start from the snapshot: map, verify and point into it
+    double open_start = get_time_ms();
+    fd = open(path, O_RDONLY);
+    void* mapped = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    int count = mapped == MAP_FAILED ? -1 : KalynaSnapshotOpen(mapped, size, opened, SNAPSHOT_SCHEDULES);
+    double open_time = get_time_ms() - open_start;
+
+    printf("\n=== Cold start (%d Kalyna-256/256 schedules, %.1f MB snapshot) ===\n", SNAPSHOT_SCHEDULES,
+           size / (1024.0 * 1024.0));
+    printf("  Expanding keys: %.3f ms\n", expand_time);
+    printf("  From snapshot:  %.3f ms (%d schedules, file in page cache)\n", open_time, count);
+
+    if (mapped != MAP_FAILED) {
+        munmap(mapped, size);
+    }
+    close(fd);
+    unlink(path);
+    memset(buffer, 0, size);
+    free(buffer);
+    for (size_t i = 0; i < SNAPSHOT_SCHEDULES; i++) {
+        KalynaDelete(ctxs[i]);
+    }
+    free(ctxs);
+    free(schedules);
+    free(opened);
+}
+
+void benchmark_store(void) {
+    uint64_t key[4] = {0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL, 0x1716151413121110ULL, 0x1f1e1d1c1b1a1918ULL};
+    uint64_t block[4] = {0};
+    size_t size = KalynaStoreSize(2 * STORE_KEYS, 256, 256);
+    void* region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    kalyna_store_t* store = KalynaStoreCreate(region, size, 2 * STORE_KEYS, 256, 256);
+
+    double put_start = get_time_ms();
+    for (size_t i = 0; i < STORE_KEYS; i++) {
+        key[0] = i;
+        KalynaStorePut(store, i + 1, key);
+    }
+    double put_time = get_time_ms() - put_start;
+
+    // Per request: lookup, encipher in place, validate
+    uint64_t seed = 1;
+    double lookup_start = get_time_ms();
+    for (int n = 0; n < BENCHMARK_ITERATIONS; n++) {
+        kalyna_schedule_t schedule;
+        uint64_t generation;
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        KalynaStoreLookup(store, (seed >> 33) % STORE_KEYS + 1, &schedule, &generation);
+        KalynaScheduleEncipher(block, &schedule, block);
+        if (!KalynaStoreValidate(store, &schedule, generation)) {
+            fprintf(stderr, "ERROR: store validation failed\n");
+        }
+    }
+    double lookup_time = get_time_ms() - lookup_start;
+
+    printf("\n=== Shared store (%d Kalyna-256/256 keys, %d workers) ===\n", STORE_KEYS, STORE_WORKERS);
+    printf("  Private contexts: %.1f MB (KalynaContextSize per key per worker)\n",
+           (double)KalynaContextSize(256, 256) * STORE_KEYS * STORE_WORKERS / (1024.0 * 1024.0));
+    printf("  Shared store:     %.1f MB (once, mapped by every worker)\n", size / (1024.0 * 1024.0));
+    printf("  Expansion:        %.3f ms once, instead of in every worker\n", put_time);
+    printf("  Lookup + block:   %.3f µs\n", lookup_time * 1000.0 / BENCHMARK_ITERATIONS);
+
+    munmap(region, size);
+}
+
+void benchmark_pool(void) {
+    // Short-lived contexts, created and destroyed in batches
+    uint64_t key[2] = {0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL};
+    kalyna_t* contexts[POOL_CONTEXTS];
+    kalyna_pool_t* pool = KalynaPoolCreate(128, 128, POOL_CONTEXTS);
+
+    double malloc_start = get_time_ms();
+    for (int n = 0; n < POOL_ROUNDS; n++) {
+        for (int i = 0; i < POOL_CONTEXTS; i++) {
+            contexts[i] = KalynaInit(128, 128);
+            KalynaKeyExpand(key, contexts[i]);
+        }
+        for (int i = 0; i < POOL_CONTEXTS; i++) {
+            KalynaDelete(contexts[i]);
+        }
+    }
+    double malloc_time = get_time_ms() - malloc_start;
+
+    double pool_start = get_time_ms();
+    for (int n = 0; n < POOL_ROUNDS; n++) {
+        for (int i = 0; i < POOL_CONTEXTS; i++) {
+            contexts[i] = KalynaPoolAcquire(pool);
+            KalynaKeyExpand(key, contexts[i]);
+        }
+        for (int i = 0; i < POOL_CONTEXTS; i++) {
+            KalynaPoolRelease(pool, contexts[i]);
+        }
+    }
+    double pool_time = get_time_ms() - pool_start;
+
+    double bulk_start = get_time_ms();
+    for (int n = 0; n < POOL_ROUNDS; n++) {
+        for (int i = 0; i < POOL_CONTEXTS; i++) {
+            contexts[i] = KalynaPoolAcquire(pool);
+            KalynaKeyExpand(key, contexts[i]);
+        }
+        KalynaPoolReleaseAll(pool);
+    }
+    double bulk_time = get_time_ms() - bulk_start;
+
+    double total = (double)POOL_CONTEXTS * POOL_ROUNDS;
+    printf("\n=== Context churn (Kalyna-128/128, batches of %d) ===\n", POOL_CONTEXTS);
+    printf("  Init + expand + delete:     %.2f M contexts/s\n", total / (malloc_time * 1000.0));
+    printf("  Pool acquire + release:     %.2f M contexts/s\n", total / (pool_time * 1000.0));
+    printf("  Pool acquire + release all: %.2f M contexts/s\n", total / (bulk_time * 1000.0));
+
+    KalynaPoolDestroy(pool);
+}
+
+void benchmark_cbc_streams(BenchmarkConfig config) {
+    // Independent records of 1 to CBC_RECORD_BLOCKS blocks under one key
+    kalyna_t* ctx = KalynaInit(config.block_size, config.key_size);
+    uint64_t key[8] = {0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL, 0x1716151413121110ULL, 0x1f1e1d1c1b1a1918ULL,
+                       0x2726252423222120ULL, 0x2f2e2d2c2b2a2928ULL, 0x3736353433323130ULL, 0x3f3e3d3c3b3a3938ULL};
+    size_t nb = config.block_size / 64;
+    uint64_t* data = (uint64_t*)calloc((size_t)CBC_RECORDS * CBC_RECORD_BLOCKS * nb, sizeof(uint64_t));
+    kalyna_cbc_stream_t* streams = (kalyna_cbc_stream_t*)calloc(CBC_RECORDS, sizeof(kalyna_cbc_stream_t));
+    uint64_t seed = 1;
+    size_t blocks = 0;
+    KalynaKeyExpand(key, ctx);
+    for (int i = 0; i < CBC_RECORDS; i++) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        streams[i].ctx = ctx;
+        streams[i].iv = key;
+        streams[i].plaintext = data + (size_t)i * CBC_RECORD_BLOCKS * nb;
+        streams[i].ciphertext = data + (size_t)i * CBC_RECORD_BLOCKS * nb;
+        streams[i].nblocks = (seed >> 33) % CBC_RECORD_BLOCKS + 1;
+        blocks += streams[i].nblocks;
+    }
+
+    double serial_start = get_time_ms();
+    for (int i = 0; i < CBC_RECORDS; i++) {
+        KalynaCbcEncipher(streams[i].plaintext, ctx, streams[i].iv, streams[i].ciphertext, streams[i].nblocks);
+    }
+    double serial_time = get_time_ms() - serial_start;
+
+    double streams_start = get_time_ms();
+    KalynaCbcEncipherStreams(streams, CBC_RECORDS);
+    double streams_time = get_time_ms() - streams_start;
+
+    double ecb_start = get_time_ms();
+    for (int i = 0; i < CBC_RECORDS; i++) {
+        KalynaEncipherBlocks(streams[i].plaintext, ctx, streams[i].ciphertext, streams[i].nblocks);
+    }
+    double ecb_time = get_time_ms() - ecb_start;
+
+    double mb = (double)blocks * config.block_size / (8.0 * 1024 * 1024);
+    printf("\n=== CBC records (%s, %d records of 1-%d blocks) ===\n", config.name, CBC_RECORDS, CBC_RECORD_BLOCKS);
+    printf("  One by one:   %.2f MB/s\n", mb * 1000.0 / serial_time);
+    printf("  Interleaved:  %.2f MB/s\n", mb * 1000.0 / streams_time);
+    printf("  ECB, for reference: %.2f MB/s\n", mb * 1000.0 / ecb_time);
+
+    free(streams);
+    free(data);
+    KalynaDelete(ctx);
+}
+
 void print_system_info() {
     printf("=== Kalyna Block Cipher Benchmark ===\n");
     printf("Compiled with: %s\n", __VERSION__);
@@ -118,6 +690,11 @@ void print_system_info() {
     #else
     printf("Architecture: Unknown\n");
     #endif
+    unsigned features = KalynaCpuFeatures();
+    printf("CPU features:%s%s%s%s\n",
+           features & KALYNA_CPU_SSSE3 ? " SSSE3" : "", features & KALYNA_CPU_AVX2 ? " AVX2" : "",
+           features & KALYNA_CPU_AVX512 ? " AVX-512" : "", features & KALYNA_CPU_GFNI ? " GFNI" : "");
+    printf("Backend override: KALYNA_BACKEND=%s\n", getenv("KALYNA_BACKEND") ? getenv("KALYNA_BACKEND") : "(auto)");
     
     printf("\nBenchmark parameters:\n");
     printf("  Iterations: %d\n", BENCHMARK_ITERATIONS);
@@ -137,7 +714,14 @@ int main(int argc, char** argv) {
 
     for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
         benchmark_variant(configs[i]);
+        benchmark_key_expansion(configs[i]);
+        benchmark_cbc_streams(configs[i]);
     }
+    benchmark_cache();
+    benchmark_registry();
+    benchmark_snapshot();
+    benchmark_store();
+    benchmark_pool();
 
     printf("\n=== Benchmark Complete ===\n");
     return 0;
@@ -0,0 +1,316 @@
+/*
+
+Bitsliced constant-time implementation of the Kalyna block cipher (DSTU 7624:2014)
+
+Up to 64 blocks are processed at once. After transposition plane
+`word * 64 + bit` holds bit `bit` of state word `word` of every block, one
+block per bit position. S-Boxes are evaluated as boolean circuits from their
+algebraic normal form (tables.c), regrouped by the high nibble of the
+monomials, ShiftRows is a plane permutation and MixColumns an XOR/shift
+network, so no memory access or branch depends on the processed data or the
+key.
+
+Only the data path is constant time: the round keys come from the regular
+(table-driven) key expansion, so expand keys where timing is not observable
+or accept that the key schedule is not protected.
+
+*/
+
+#include <pthread.h>
+
+#include "transformations.h"
+#include "tables.h"
+
+
+#define kBITSLICE_PLANES (kNB_512 * kBITS_IN_WORD)
+
+/* Plane holding bit `bit` of state matrix byte (`row`, `col`). */
+#define PLANE(col, row, bit) ((col) * kBITS_IN_WORD + (row) * kBITS_IN_BYTE + (bit))
+
+
+/*!
+ * Transpose 64x64 bit matrix in place: bit `j` of a[i] is exchanged with
+ * bit `i` of a[j].
+ */
+static void Transpose64(uint64_t* a) {
+    int j, k;
+    uint64_t m = 0x00000000FFFFFFFFULL;
+    uint64_t t;
+    for (j = 32; j != 0; j >>= 1, m ^= m << j) {
+        for (k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+            t = ((a[k] >> j) ^ a[k | j]) & m;
+            a[k] ^= t << j;
+            a[k | j] ^= t;
+        }
+    }
+}
+
+static void BitslicedLoad(const uint64_t* in, size_t nb, size_t nblocks, uint64_t* planes) {
+    size_t col, j;
+    for (col = 0; col < nb; ++col) {
+        for (j = 0; j < kBITS_IN_WORD; ++j) {
+            planes[col * kBITS_IN_WORD + j] = j < nblocks ? in[j * nb + col] : 0;
+        }
+        Transpose64(planes + col * kBITS_IN_WORD);
+    }
+}
+
+static void BitslicedStore(uint64_t* planes, size_t nb, size_t nblocks, uint64_t* out) {
+    size_t col, j;
+    for (col = 0; col < nb; ++col) {
+        Transpose64(planes + col * kBITS_IN_WORD);
+        for (j = 0; j < nblocks; ++j) {
+            out[j * nb + col] = planes[col * kBITS_IN_WORD + j];
+        }
+    }
+}
+
+/*!
+ * S-Box algebraic normal form regrouped by the high nibble of the monomials:
+ * output bit `bit` of S-Box `box` is the XOR over `high` of
+ * (monomial `high` of x4..x7) AND (the low nibble monomials of x0..x3 in the
+ * 16 bit set of that `high`). The set is stored as four nibbles, each
+ * selecting a sum of four low monomials precomputed once per S-Box call.
+ */
+typedef struct {
+    uint8_t select[4][kBITS_IN_BYTE][16][4];
+} anf_terms_t;
+
+static void UnpackAnf(uint64_t anf[4][8][4], anf_terms_t* terms) {
+    int box, bit, m, g;
+    unsigned low[16];
+    for (box = 0; box < 4; ++box) {
+        for (bit = 0; bit < kBITS_IN_BYTE; ++bit) {
+            memset(low, 0, sizeof(low));
+            for (m = 0; m < 256; ++m) {
+                if ((anf[box][bit][m / kBITS_IN_WORD] >> (m % kBITS_IN_WORD)) & 1)
+                    low[m >> 4] |= 1u << (m & 15);
+            }
+            for (m = 0; m < 16; ++m) {
+                for (g = 0; g < 4; ++g)
+                    terms->select[box][bit][m][g] = (uint8_t)((low[m] >> (4 * g)) & 15);
+            }
+        }
+    }
+}
+
+static anf_terms_t anf_enc, anf_dec;
+static pthread_once_t anf_once = PTHREAD_ONCE_INIT;
+
+static void UnpackAnfTables(void) {
+    UnpackAnf(sboxes_anf_enc, &anf_enc);
+    UnpackAnf(sboxes_anf_dec, &anf_dec);
+}
+
+/* Monomials of 4 bit planes: m[k] is the AND of x[i] for the bits i of k. */
+static void NibbleMonomials(const uint64_t* x, uint64_t* m) {
+    int i, k;
+    m[0] = ~0ULL;
+    for (i = 0; i < 4; ++i) {
+        for (k = 1 << i; k < 2 << i; ++k)
+            m[k] = m[k ^ (1 << i)] & x[i];
+    }
+}
+
+/*!
+ * Evaluate S-Box `box` on 8 bit planes in place. The terms visited depend
+ * only on the S-Box, not on the data.
+ */
+static void BitslicedSBox(uint64_t* x, const anf_terms_t* anf, int box) {
+    int i, h, g, j, c;
+    uint64_t low[16], high[16];
+    uint64_t sums[4][16];
+    uint64_t y[8];
+    uint64_t acc;
+    const uint8_t* select;
+
+    NibbleMonomials(x, low);
+    NibbleMonomials(x + 4, high);
+    /* sums[g][c]: XOR of the low monomials 4g + j for the bits j of c. */
+    for (g = 0; g < 4; ++g) {
+        sums[g][0] = 0;
+        for (j = 0; j < 4; ++j) {
+            for (c = 1 << j; c < 2 << j; ++c)
+                sums[g][c] = sums[g][c ^ (1 << j)] ^ low[4 * g + j];
+        }
+    }
+    for (i = 0; i < kBITS_IN_BYTE; ++i) {
+        acc = 0;
+        for (h = 0; h < 16; ++h) {
+            select = anf->select[box][i][h];
+            acc ^= high[h] & (sums[0][select[0]] ^ sums[1][select[1]] ^ sums[2][select[2]] ^ sums[3][select[3]]);
+        }
+        y[i] = acc;
+    }
+    memcpy(x, y, sizeof(y));
+}
+
+static void BitslicedSubBytes(uint64_t* planes, size_t nb, const anf_terms_t* anf) {
+    size_t col, row;
+    for (col = 0; col < nb; ++col) {
+        for (row = 0; row < sizeof(uint64_t); ++row) {
+            BitslicedSBox(planes + PLANE(col, row, 0), anf, row % 4);
+        }
+    }
+}
+
+static void BitslicedShiftRows(uint64_t* planes, size_t nb, int inverse) {
+    size_t col, row, shift, from;
+    uint64_t nplanes[kBITSLICE_PLANES];
+    for (row = 0; row < sizeof(uint64_t); ++row) {
+        shift = row * nb / sizeof(uint64_t);
+        for (col = 0; col < nb; ++col) {
+            from = inverse ? (col + shift) % nb : (col + nb - shift) % nb;
+            memcpy(nplanes + PLANE(col, row, 0), planes + PLANE(from, row, 0),
+                   kBITS_IN_BYTE * sizeof(uint64_t));
+        }
+    }
+    memcpy(planes, nplanes, nb * kBITS_IN_WORD * sizeof(uint64_t));
+}
+
+/*!
+ * Multiply 8 bit planes by x modulo kREDUCTION_POLYNOMIAL in place.
+ */
+static void BitslicedDouble(uint64_t* x) {
+    uint64_t hbit = x[7];
+    x[7] = x[6];
+    x[6] = x[5];
+    x[5] = x[4];
+    x[4] = x[3] ^ hbit;
+    x[3] = x[2] ^ hbit;
+    x[2] = x[1] ^ hbit;
+    x[1] = x[0];
+    x[0] = hbit;
+}
+
+static void BitslicedMixColumns(uint64_t* planes, size_t nb, uint8_t matrix[8][8]) {
+    size_t col, row, b;
+    int i, k;
+    uint64_t powers[kBITS_IN_BYTE][kBITS_IN_BYTE];
+    uint64_t result[kBITS_IN_WORD];
+
+    for (col = 0; col < nb; ++col) {
+        memset(result, 0, sizeof(result));
+        for (b = 0; b < sizeof(uint64_t); ++b) {
+            /* powers[k] = x^k * (input byte b) */
+            memcpy(powers[0], planes + PLANE(col, b, 0), sizeof(powers[0]));
+            for (k = 1; k < kBITS_IN_BYTE; ++k) {
+                memcpy(powers[k], powers[k - 1], sizeof(powers[k]));
+                BitslicedDouble(powers[k]);
+            }
+            for (row = 0; row < sizeof(uint64_t); ++row) {
+                for (k = 0; k < kBITS_IN_BYTE; ++k) {
+                    if ((matrix[row][b] >> k) & 1) {
+                        for (i = 0; i < kBITS_IN_BYTE; ++i) {
+                            result[row * kBITS_IN_BYTE + i] ^= powers[k][i];
+                        }
+                    }
+                }
+            }
+        }
+        memcpy(planes + PLANE(col, 0, 0), result, sizeof(result));
+    }
+}
+
+static void BitslicedXorRoundKey(uint64_t* planes, size_t nb, const uint64_t* key) {
+    size_t col;
+    int bit;
+    for (col = 0; col < nb; ++col) {
+        for (bit = 0; bit < kBITS_IN_WORD; ++bit) {
+            planes[col * kBITS_IN_WORD + bit] ^= 0 - ((key[col] >> bit) & 1);
+        }
+    }
+}
+
+/*!
+ * Add (or subtract) round key modulo 2^{64} with a ripple-carry adder
+ * across the bit planes of each state word.
+ */
+static void BitslicedAddRoundKey(uint64_t* planes, size_t nb, const uint64_t* key, int subtract) {
+    size_t col;
+    int bit;
+    uint64_t a, k, carry;
+    for (col = 0; col < nb; ++col) {
+        /* a - k = a + ~k + 1 */
+        carry = subtract ? ~0ULL : 0;
+        for (bit = 0; bit < kBITS_IN_WORD; ++bit) {
+            a = planes[col * kBITS_IN_WORD + bit];
+            k = 0 - ((key[col] >> bit) & 1);
+            if (subtract)
+                k = ~k;
+            planes[col * kBITS_IN_WORD + bit] = a ^ k ^ carry;
+            carry = (a & k) | (carry & (a ^ k));
+        }
+    }
+}
+
+
+void BitslicedEncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule,
+                             uint64_t* ciphertext, size_t nblocks) {
+    size_t round, n, nb = schedule->nb;
+    uint64_t planes[kBITSLICE_PLANES];
+
+    pthread_once(&anf_once, UnpackAnfTables);
+    for (; nblocks > 0; nblocks -= n) {
+        n = nblocks < kBITSLICE_BLOCKS ? nblocks : kBITSLICE_BLOCKS;
+        BitslicedLoad(plaintext, nb, n, planes);
+
+        BitslicedAddRoundKey(planes, nb, schedule->round_keys, FALSE);
+        for (round = 1; round <= schedule->nr; ++round) {
+            BitslicedSubBytes(planes, nb, &anf_enc);
+            BitslicedShiftRows(planes, nb, FALSE);
+            BitslicedMixColumns(planes, nb, mds_matrix);
+            if (round < schedule->nr)
+                BitslicedXorRoundKey(planes, nb, schedule->round_keys + round * nb);
+        }
+        BitslicedAddRoundKey(planes, nb, schedule->round_keys + schedule->nr * nb, FALSE);
+
+        BitslicedStore(planes, nb, n, ciphertext);
+        plaintext += n * nb;
+        ciphertext += n * nb;
+    }
+    SecureZero(planes, sizeof(planes));
+}
+
+void BitslicedDecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule,
+                             uint64_t* plaintext, size_t nblocks) {
+    size_t round, n, nb = schedule->nb;
+    uint64_t planes[kBITSLICE_PLANES];
+
+    pthread_once(&anf_once, UnpackAnfTables);
+    for (; nblocks > 0; nblocks -= n) {
+        n = nblocks < kBITSLICE_BLOCKS ? nblocks : kBITSLICE_BLOCKS;
+        BitslicedLoad(ciphertext, nb, n, planes);
+
+        BitslicedAddRoundKey(planes, nb, schedule->round_keys + schedule->nr * nb, TRUE);
+        for (round = schedule->nr; round > 0; --round) {
+            BitslicedMixColumns(planes, nb, mds_inv_matrix);
+            BitslicedShiftRows(planes, nb, TRUE);
+            BitslicedSubBytes(planes, nb, &anf_dec);
+            if (round > 1)
+                BitslicedXorRoundKey(planes, nb, schedule->round_keys + (round - 1) * nb);
+        }
+        BitslicedAddRoundKey(planes, nb, schedule->round_keys, TRUE);
+
+        BitslicedStore(planes, nb, n, plaintext);
+        ciphertext += n * nb;
+        plaintext += n * nb;
+    }
+    SecureZero(planes, sizeof(planes));
+}
+
+void BitslicedEncipher(const uint64_t* plaintext, const kalyna_schedule_t* schedule, uint64_t* ciphertext) {
+    BitslicedEncipherBlocks(plaintext, schedule, ciphertext, 1);
+}
+
+void BitslicedDecipher(const uint64_t* ciphertext, const kalyna_schedule_t* schedule, uint64_t* plaintext) {
+    BitslicedDecipherBlocks(ciphertext, schedule, plaintext, 1);
+}
+
+void KalynaBitslicedEncipher(const uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext, size_t nblocks) {
+    BitslicedEncipherBlocks(plaintext, &ctx->key_schedule, ciphertext, nblocks);
+}
+
+void KalynaBitslicedDecipher(const uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext, size_t nblocks) {
+    BitslicedDecipherBlocks(ciphertext, &ctx->key_schedule, plaintext, nblocks);
+}
@@ -0,0 +1,234 @@
+/*
+
+Thread-safe cache of expanded key schedules of the Kalyna block cipher (DSTU 7624:2014)
+
+Every slot owns storage for a context of the largest variant, so a miss
+expands the key in place without allocating. The victim slot is pinned and
+taken out of the index first, so the expansion itself runs without the lock
+and the slot is published afterwards. Slots are found through a hash
+index of key fingerprints, a full key comparison confirms a match. Victims
+are chosen in CLOCK order, skipping schedules acquired and not yet released.
+
+*/
+
+#include <pthread.h>
+
+#include "transformations.h"
+
+
+#define kCACHE_NO_SLOT ((size_t)-1)
+
+typedef struct {
+    uint64_t key[kNK_512];  /* Copy of the master key, compared on lookup. */
+    uint64_t fingerprint;
+    size_t block_size;
+    size_t key_size;
+    size_t next;  /* Next slot of the same hash bucket. */
+    size_t refs;  /* Acquisitions not yet released, pinned while nonzero. */
+    int referenced;  /* CLOCK reference bit. */
+    kalyna_t* ctx;  /* NULL for free slots. */
+} cache_slot_t;
+
+struct kalyna_cache_s {
+    pthread_mutex_t lock;
+    size_t capacity;
+    size_t used;  /* Slots [0, used) have been filled. */
+    size_t hand;  /* CLOCK hand. */
+    size_t bucket_mask;
+    size_t slot_size;
+    size_t* buckets;
+    cache_slot_t* slots;
+    uint8_t* storage;
+    kalyna_cache_stats_t stats;
+};
+
+
+/* Finalizer of splitmix64. */
+static uint64_t Mix(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+static uint64_t Fingerprint(size_t block_size, size_t key_size, const uint64_t* key) {
+    size_t i;
+    uint64_t h = Mix(block_size * 0x9e3779b97f4a7c15ULL + key_size);
+    for (i = 0; i < key_size / kBITS_IN_WORD; ++i)
+        h = Mix(h ^ key[i]);
+    return h;
+}
+
+static void Unlink(kalyna_cache_t* cache, size_t index) {
+    size_t* link = &cache->buckets[cache->slots[index].fingerprint & cache->bucket_mask];
+    while (*link != index)
+        link = &cache->slots[*link].next;
+    *link = cache->slots[index].next;
+}
+
+/* Clear the key, its fingerprint and the schedules of a filled slot. */
+static void WipeSlot(cache_slot_t* slot) {
+    KalynaDelete(slot->ctx);
+    SecureZero(slot->key, sizeof(slot->key));
+    slot->fingerprint = 0;
+    slot->ctx = NULL;
+}
+
+/* Slot holding the schedule of `key`, or kCACHE_NO_SLOT. Called locked. */
+static size_t Lookup(kalyna_cache_t* cache, uint64_t fingerprint, size_t block_size, size_t key_size,
+                     const uint64_t* key) {
+    size_t index;
+    cache_slot_t* slot;
+    for (index = cache->buckets[fingerprint & cache->bucket_mask]; index != kCACHE_NO_SLOT; index = slot->next) {
+        slot = &cache->slots[index];
+        if (slot->fingerprint == fingerprint && slot->block_size == block_size && slot->key_size == key_size &&
+                memcmp(slot->key, key, key_size / 8) == 0)
+            return index;
+    }
+    return kCACHE_NO_SLOT;
+}
+
+/* Free slot, or the first unpinned slot without the reference bit. */
+static size_t Victim(kalyna_cache_t* cache) {
+    size_t n, index;
+    if (cache->used < cache->capacity)
+        return cache->used++;
+    /* Two sweeps: the first may only clear reference bits. */
+    for (n = 0; n < 2 * cache->capacity; ++n) {
+        index = cache->hand;
+        cache->hand = (cache->hand + 1) % cache->capacity;
+        if (cache->slots[index].refs != 0)
+            continue;
+        if (cache->slots[index].referenced) {
+            cache->slots[index].referenced = 0;
+            continue;
+        }
+        return index;
+    }
+    return kCACHE_NO_SLOT;
+}
+
+kalyna_cache_t* KalynaCacheCreate(size_t capacity) {
+    size_t i, nbuckets = 1;
+    kalyna_cache_t* cache;
+
+    if (capacity == 0)
+        return NULL;
+    cache = (kalyna_cache_t*)calloc(1, sizeof(kalyna_cache_t));
+    if (cache == NULL) {
+        perror("Could not allocate memory for schedule cache.");
+        return NULL;
+    }
+    while (nbuckets < 2 * capacity)
+        nbuckets *= 2;
+    cache->capacity = capacity;
+    cache->bucket_mask = nbuckets - 1;
+    cache->slot_size = KalynaContextSize(kBLOCK_512, kKEY_512);
+    cache->buckets = (size_t*)malloc(nbuckets * sizeof(size_t));
+    cache->slots = (cache_slot_t*)calloc(capacity, sizeof(cache_slot_t));
+    cache->storage = (uint8_t*)malloc(capacity * cache->slot_size);
+    if (cache->buckets == NULL || cache->slots == NULL || cache->storage == NULL) {
+        perror("Could not allocate memory for schedule cache.");
+        free(cache->buckets);
+        free(cache->slots);
+        free(cache->storage);
+        free(cache);
+        return NULL;
+    }
+    for (i = 0; i < nbuckets; ++i)
+        cache->buckets[i] = kCACHE_NO_SLOT;
+    pthread_mutex_init(&cache->lock, NULL);
+    return cache;
+}
+
+void KalynaCacheDestroy(kalyna_cache_t* cache) {
+    size_t i;
+    for (i = 0; i < cache->used; ++i) {
+        if (cache->slots[i].ctx != NULL)
+            WipeSlot(&cache->slots[i]);
+    }
+    pthread_mutex_destroy(&cache->lock);
+    free(cache->buckets);
+    free(cache->slots);
+    free(cache->storage);
+    free(cache);
+}
+
+const kalyna_schedule_t* KalynaCacheAcquire(kalyna_cache_t* cache, size_t block_size, size_t key_size,
+                                            const uint64_t* key) {
+    size_t index, found;
+    cache_slot_t* slot;
+    kalyna_t* ctx;
+    uint64_t fingerprint;
+
+    /* Unsupported sizes are neither hits nor misses. */
+    if (KalynaContextSize(block_size, key_size) == 0)
+        return NULL;
+    fingerprint = Fingerprint(block_size, key_size, key);
+    pthread_mutex_lock(&cache->lock);
+    index = Lookup(cache, fingerprint, block_size, key_size, key);
+    if (index != kCACHE_NO_SLOT) {
+        slot = &cache->slots[index];
+        ++cache->stats.hits;
+        ++slot->refs;
+        slot->referenced = 1;
+        pthread_mutex_unlock(&cache->lock);
+        return &slot->ctx->key_schedule;
+    }
+
+    ++cache->stats.misses;
+    index = Victim(cache);
+    if (index == kCACHE_NO_SLOT) {
+        pthread_mutex_unlock(&cache->lock);
+        fprintf(stderr, "Error: all cached schedules are in use.\n");
+        return NULL;
+    }
+    slot = &cache->slots[index];
+    if (slot->ctx != NULL) {
+        Unlink(cache, index);
+        WipeSlot(slot);
+        ++cache->stats.evictions;
+    }
+    /* Pinned and in no bucket, the slot's storage is ours: expand the key
+     * into it without holding the lock. */
+    slot->refs = 1;
+    pthread_mutex_unlock(&cache->lock);
+    ctx = KalynaInitBuffer(cache->storage + index * cache->slot_size, cache->slot_size, block_size, key_size);
+    KalynaKeyExpand((uint64_t*)key, ctx);
+
+    pthread_mutex_lock(&cache->lock);
+    found = Lookup(cache, fingerprint, block_size, key_size, key);
+    if (found != kCACHE_NO_SLOT) {
+        /* Another thread cached the same key meanwhile: use its slot and
+         * give ours back empty. */
+        KalynaDelete(ctx);
+        slot->refs = 0;
+        slot = &cache->slots[found];
+        ++slot->refs;
+        slot->referenced = 1;
+        pthread_mutex_unlock(&cache->lock);
+        return &slot->ctx->key_schedule;
+    }
+    slot->ctx = ctx;
+    memcpy(slot->key, key, key_size / 8);
+    slot->fingerprint = fingerprint;
+    slot->block_size = block_size;
+    slot->key_size = key_size;
+    slot->referenced = 1;
+    slot->next = cache->buckets[fingerprint & cache->bucket_mask];
+    cache->buckets[fingerprint & cache->bucket_mask] = index;
+    pthread_mutex_unlock(&cache->lock);
+    return &slot->ctx->key_schedule;
+}
+
+void KalynaCacheRelease(kalyna_cache_t* cache, const kalyna_schedule_t* schedule) {
+    size_t index = (size_t)((const uint8_t*)schedule - cache->storage) / cache->slot_size;
+    pthread_mutex_lock(&cache->lock);
+    --cache->slots[index].refs;
+    pthread_mutex_unlock(&cache->lock);
+}
+
+void KalynaCacheStats(kalyna_cache_t* cache, kalyna_cache_stats_t* stats) {
+    pthread_mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    pthread_mutex_unlock(&cache->lock);
+}
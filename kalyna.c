@@ -10,77 +10,184 @@ Authors: Ruslan Kiianchuk, Ruslan Mordvinov, Roman Oliynykov
 #include "tables.h"
 
 
-kalyna_t* KalynaInit(size_t block_size, size_t key_size) {
-    int i;
-    kalyna_t* ctx = (kalyna_t*)malloc(sizeof(kalyna_t));
-
+int VariantParameters(size_t block_size, size_t key_size, size_t* nb, size_t* nk, size_t* nr) {
     if (block_size == kBLOCK_128) {
-        ctx->nb = kBLOCK_128 / kBITS_IN_WORD;
+        *nb = kBLOCK_128 / kBITS_IN_WORD;
         if (key_size == kKEY_128) {
-            ctx->nk = kKEY_128 / kBITS_IN_WORD;
-            ctx->nr = kNR_128;
+            *nk = kKEY_128 / kBITS_IN_WORD;
+            *nr = kNR_128;
         } else if (key_size == kKEY_256){
-            ctx->nk =  kKEY_256 / kBITS_IN_WORD;
-            ctx->nr = kNR_256;
+            *nk =  kKEY_256 / kBITS_IN_WORD;
+            *nr = kNR_256;
         } else {
             fprintf(stderr, "Error: unsupported key size.\n");
-            return NULL;
+            return -1;
         }
     } else if (block_size == 256) {
-        ctx->nb = kBLOCK_256 / kBITS_IN_WORD;
+        *nb = kBLOCK_256 / kBITS_IN_WORD;
         if (key_size == kKEY_256) {
-            ctx->nk = kKEY_256 / kBITS_IN_WORD;
-            ctx->nr = kNR_256;
+            *nk = kKEY_256 / kBITS_IN_WORD;
+            *nr = kNR_256;
         } else if (key_size == kKEY_512){
-            ctx->nk = kKEY_512 / kBITS_IN_WORD;
-            ctx->nr = kNR_512;
+            *nk = kKEY_512 / kBITS_IN_WORD;
+            *nr = kNR_512;
         } else {
             fprintf(stderr, "Error: unsupported key size.\n");
-            return NULL;
+            return -1;
         }
     } else if (block_size == kBLOCK_512) {
-        ctx->nb = kBLOCK_512 / kBITS_IN_WORD;
+        *nb = kBLOCK_512 / kBITS_IN_WORD;
         if (key_size == kKEY_512) {
-            ctx->nk = kKEY_512 / kBITS_IN_WORD;
-            ctx->nr = kNR_512;
+            *nk = kKEY_512 / kBITS_IN_WORD;
+            *nr = kNR_512;
         } else {
             fprintf(stderr, "Error: unsupported key size.\n");
-            return NULL;
+            return -1;
         }
     } else {
         fprintf(stderr, "Error: unsupported block size.\n");
-        return NULL;
+        return -1;
     }
+    return 0;
+}
 
-    ctx->state = (uint64_t*)calloc(ctx->nb, sizeof(uint64_t));
-    if (ctx->state == NULL)
-        perror("Could not allocate memory for cipher state.");
+/*!
+ * Bytes of the context layout, see CONTEXT_LAYOUT_SIZE().
+ */
+static size_t ContextLayoutSize(size_t nb, size_t nr) {
+    return CONTEXT_LAYOUT_SIZE(nb, nr);
+}
 
-    ctx->round_keys = (uint64_t**)calloc(ctx->nr + 1, sizeof(uint64_t**));
-    if (ctx->round_keys == NULL) 
-        perror("Could not allocate memory for cipher round keys.");
+/*!
+ * Lay out a zeroed context in `memory` (aligned to kCONTEXT_ALIGNMENT and
+ * ContextLayoutSize() bytes long).
+ */
+static kalyna_t* ContextLayout(void* memory, size_t nb, size_t nk, size_t nr) {
+    size_t i;
+    uint8_t* p = (uint8_t*)memory;
+    kalyna_t* ctx = (kalyna_t*)p;
+
+    memset(memory, 0, ContextLayoutSize(nb, nr));
+    ctx->nb = nb;
+    ctx->nk = nk;
+    ctx->nr = nr;
+    p += ALIGN_UP(sizeof(kalyna_t));
+    ctx->state = (uint64_t*)p;
+    p += ALIGN_UP(nb * sizeof(uint64_t));
+    ctx->schedule = (uint64_t*)p;
+    p += ALIGN_UP((nr + 1) * nb * sizeof(uint64_t));
+    ctx->inv_schedule = (uint64_t*)p;
+    p += ALIGN_UP((nr + 1) * nb * sizeof(uint64_t));
+    ctx->round_keys = (uint64_t**)p;
+    ctx->inv_round_keys = ctx->round_keys + nr + 1;
+    for (i = 0; i <= nr; ++i) {
+        ctx->round_keys[i] = ctx->schedule + i * nb;
+        ctx->inv_round_keys[i] = ctx->inv_schedule + i * nb;
+    }
+    ctx->key_schedule.nb = nb;
+    ctx->key_schedule.nk = nk;
+    ctx->key_schedule.nr = nr;
+    ctx->key_schedule.round_keys = ctx->schedule;
+    ctx->key_schedule.inv_round_keys = ctx->inv_schedule;
+    return ctx;
+}
+
+size_t KalynaContextSize(size_t block_size, size_t key_size) {
+    size_t nb, nk, nr;
+    if (VariantParameters(block_size, key_size, &nb, &nk, &nr) != 0)
+        return 0;
+    return ContextLayoutSize(nb, nr) + kCONTEXT_ALIGNMENT - 1;
+}
 
-    for (i = 0; i < ctx->nr + 1; ++i) {
-        ctx->round_keys[i] = (uint64_t*)calloc(ctx->nb, sizeof(uint64_t));
-        if (ctx->round_keys[i] == NULL)
-            perror("Could not allocate memory for cipher round keys.");
+kalyna_t* KalynaInitBuffer(void* buffer, size_t buffer_size, size_t block_size, size_t key_size) {
+    size_t nb, nk, nr;
+    kalyna_t* ctx;
+    kalyna_backend_t backend = BackendFromEnvironment();
+
+    if (VariantParameters(block_size, key_size, &nb, &nk, &nr) != 0)
+        return NULL;
+    if (buffer == NULL || buffer_size < ContextLayoutSize(nb, nr) + kCONTEXT_ALIGNMENT - 1) {
+        fprintf(stderr, "Error: context buffer too small.\n");
+        return NULL;
+    }
+    ctx = ContextLayout((void*)ALIGN_UP((size_t)buffer), nb, nk, nr);
+
+    if (KalynaSetBackend(ctx, backend) != 0) {
+        fprintf(stderr, "Warning: unsupported backend %s, using auto.\n", KalynaBackendName(backend));
+        KalynaSetBackend(ctx, KALYNA_BACKEND_AUTO);
     }
     return ctx;
 }
 
+/* Compact schedules are packed densely (word aligned), many of them are
+ * expected to be live at once. */
+#define ALIGN_WORD(size) (((size) + sizeof(uint64_t) - 1) & ~(size_t)(sizeof(uint64_t) - 1))
 
-int KalynaDelete(kalyna_t* ctx) {
-    int i;
-    free(ctx->state);
-    for (i = 0; i < ctx->nr + 1; ++i) {
-        free(ctx->round_keys[i]);
+size_t KalynaCompactScheduleSize(size_t block_size, size_t key_size) {
+    size_t nb, nk, nr;
+    if (VariantParameters(block_size, key_size, &nb, &nk, &nr) != 0)
+        return 0;
+    return ALIGN_WORD(sizeof(kalyna_schedule_t)) + (nr / 2 + 1) * nb * sizeof(uint64_t) + sizeof(uint64_t) - 1;
+}
+
+kalyna_schedule_t* KalynaCompactScheduleInit(void* buffer, size_t buffer_size, size_t block_size,
+                                             size_t key_size, const uint64_t* key) {
+    kalyna_schedule_t* schedule;
+    size_t size = KalynaCompactScheduleSize(block_size, key_size);
+
+    if (size == 0)
+        return NULL;
+    if (buffer == NULL || buffer_size < size) {
+        fprintf(stderr, "Error: schedule buffer too small.\n");
+        return NULL;
     }
-    free(ctx->round_keys);
-    free(ctx);
-    ctx = NULL;
+    schedule = (kalyna_schedule_t*)ALIGN_WORD((size_t)buffer);
+    VariantParameters(block_size, key_size, &schedule->nb, &schedule->nk, &schedule->nr);
+    CompactKeyExpand(key, schedule, (uint64_t*)((uint8_t*)schedule + ALIGN_WORD(sizeof(kalyna_schedule_t))));
+    return schedule;
+}
+
+void KalynaCompactScheduleWipe(kalyna_schedule_t* schedule) {
+    SecureZero((void*)schedule->round_keys, (schedule->nr / 2 + 1) * schedule->nb * sizeof(uint64_t));
+}
+
+kalyna_t* KalynaInit(size_t block_size, size_t key_size) {
+    size_t size = KalynaContextSize(block_size, key_size);
+    void* memory;
+    kalyna_t* ctx;
+
+    if (size == 0)
+        return NULL;
+    memory = malloc(size);
+    if (memory == NULL) {
+        perror("Could not allocate memory for cipher context.");
+        return NULL;
+    }
+    ctx = KalynaInitBuffer(memory, size, block_size, key_size);
+    ctx->memory = memory;
+    return ctx;
+}
+
+int KalynaDelete(kalyna_t* ctx) {
+    void* memory = ctx->memory;
+    /* Do not leave key material behind in either kind of storage. */
+    SecureZero(ctx->schedule, (ctx->nr + 1) * ctx->nb * sizeof(uint64_t));
+    SecureZero(ctx->inv_schedule, (ctx->nr + 1) * ctx->nb * sizeof(uint64_t));
+    SecureZero(ctx->state, ctx->nb * sizeof(uint64_t));
+    free(memory);
     return 0;
 }
 
+void SecureZero(void* buffer, size_t length) {
+    volatile uint8_t* p = (volatile uint8_t*)buffer;
+    while (length--)
+        *p++ = 0;
+}
+
+const uint64_t* KalynaRoundKey(const kalyna_t* ctx, size_t round) {
+    return ctx->schedule + round * ctx->nb;
+}
+
 
 void SubBytes(kalyna_t* ctx) {
     int i;
@@ -117,8 +224,8 @@ void ShiftRows(kalyna_t* ctx) {
     int row, col;
     int shift = -1;
 
+    uint8_t nstate[kNB_512 * sizeof(uint64_t)];
     uint8_t* state = WordsToBytes(ctx->nb, ctx->state);
-    uint8_t* nstate = (uint8_t*) malloc(ctx->nb * sizeof(uint64_t));
 
     for (row = 0; row < sizeof(uint64_t); ++row) {
         if (row % (sizeof(uint64_t) / ctx->nb) == 0)
@@ -128,16 +235,16 @@ void ShiftRows(kalyna_t* ctx) {
         }
     }
 
-    ctx->state = BytesToWords(ctx->nb * sizeof(uint64_t), nstate);
-    free(state);
+    memcpy(state, nstate, ctx->nb * sizeof(uint64_t));
+    BytesToWords(ctx->nb, state);
 }
 
 void InvShiftRows(kalyna_t* ctx) {
     int row, col;
     int shift = -1;
 
+    uint8_t nstate[kNB_512 * sizeof(uint64_t)];
     uint8_t* state = WordsToBytes(ctx->nb, ctx->state);
-    uint8_t* nstate = (uint8_t*) malloc(ctx->nb * sizeof(uint64_t));
 
     for (row = 0; row < sizeof(uint64_t); ++row) {
         if (row % (sizeof(uint64_t) / ctx->nb) == 0)
@@ -147,8 +254,8 @@ void InvShiftRows(kalyna_t* ctx) {
         }
     }
 
-    ctx->state = BytesToWords(ctx->nb * sizeof(uint64_t), nstate);
-    free(state);
+    memcpy(state, nstate, ctx->nb * sizeof(uint64_t));
+    BytesToWords(ctx->nb, state);
 }
 
 
@@ -202,12 +309,60 @@ void EncipherRound(kalyna_t* ctx) {
     MixColumns(ctx);
 }
 
+void EncipherRoundTable(kalyna_t* ctx) {
+    size_t row, col;
+    size_t shift;
+    uint64_t nstate[kNB_512];
+
+    for (col = 0; col < ctx->nb; ++col) {
+        nstate[col] = 0;
+        for (row = 0; row < sizeof(uint64_t); ++row) {
+            /* Byte of the row comes from the column it is shifted out of. */
+            shift = row * ctx->nb / sizeof(uint64_t);
+            nstate[col] ^= ttables_enc[row][(ctx->state[(col + ctx->nb - shift) % ctx->nb] >> (row * kBITS_IN_BYTE)) & 0xFF];
+        }
+    }
+    memcpy(ctx->state, nstate, ctx->nb * sizeof(uint64_t));
+}
+
 void DecipherRound(kalyna_t* ctx) {
     InvMixColumns(ctx);
     InvShiftRows(ctx);
     InvSubBytes(ctx);
 }
 
+void DecipherRoundTable(kalyna_t* ctx) {
+    size_t row, col;
+    size_t shift;
+    uint64_t nstate[kNB_512];
+
+    for (col = 0; col < ctx->nb; ++col) {
+        nstate[col] = 0;
+        for (row = 0; row < sizeof(uint64_t); ++row) {
+            /* Byte of the row comes from the column it is shifted back from. */
+            shift = row * ctx->nb / sizeof(uint64_t);
+            nstate[col] ^= ttables_dec[row][(ctx->state[(col + shift) % ctx->nb] >> (row * kBITS_IN_BYTE)) & 0xFF];
+        }
+    }
+    memcpy(ctx->state, nstate, ctx->nb * sizeof(uint64_t));
+}
+
+void InvMixColumnsTable(kalyna_t* ctx) {
+    size_t row, col;
+    uint8_t b;
+    uint64_t result;
+
+    for (col = 0; col < ctx->nb; ++col) {
+        result = 0;
+        for (row = 0; row < sizeof(uint64_t); ++row) {
+            b = (ctx->state[col] >> (row * kBITS_IN_BYTE)) & 0xFF;
+            result ^= ttables_dec[row][sboxes_enc[row % 4][b]];
+        }
+        ctx->state[col] = result;
+    }
+}
+
+
 void AddRoundKey(int round, kalyna_t* ctx) {
     int i;
     for (i = 0; i < ctx->nb; ++i) {
@@ -268,23 +423,21 @@ void RotateLeft(size_t state_size, uint64_t* state_value) {
     size_t rotate_bytes = 2 * state_size + 3;
     size_t bytes_num = state_size * (kBITS_IN_WORD / kBITS_IN_BYTE);
 
+    uint8_t buffer[2 * kNB_512 + 3];
     uint8_t* bytes = WordsToBytes(state_size, state_value);
-    uint8_t* buffer = (uint8_t*) malloc(rotate_bytes);
 
     /* Rotate bytes in memory. */
     memcpy(buffer, bytes, rotate_bytes);
     memmove(bytes, bytes + rotate_bytes, bytes_num - rotate_bytes);
     memcpy(bytes + bytes_num - rotate_bytes, buffer, rotate_bytes);
 
-    state_value = BytesToWords(bytes_num, bytes);
-
-    free(buffer);
+    BytesToWords(state_size, bytes);
 }
 
 
-void KeyExpandKt(uint64_t* key, kalyna_t* ctx, uint64_t* kt) {
-    uint64_t* k0 = (uint64_t*) malloc(ctx->nb * sizeof(uint64_t));
-    uint64_t* k1 = (uint64_t*) malloc(ctx->nb * sizeof(uint64_t));
+void KeyExpandKt(const uint64_t* key, kalyna_t* ctx, uint64_t* kt) {
+    uint64_t k0[kNB_512];
+    uint64_t k1[kNB_512];
 	
 	memset(ctx->state, 0, ctx->nb * sizeof(uint64_t));
     ctx->state[0] += ctx->nb + ctx->nk + 1;
@@ -298,23 +451,20 @@ void KeyExpandKt(uint64_t* key, kalyna_t* ctx, uint64_t* kt) {
     }
 
     AddRoundKeyExpand(k0, ctx);
-    EncipherRound(ctx);
+    EncipherRoundTable(ctx);
     XorRoundKeyExpand(k1, ctx);
-    EncipherRound(ctx);
+    EncipherRoundTable(ctx);
     AddRoundKeyExpand(k0, ctx);
-    EncipherRound(ctx);
+    EncipherRoundTable(ctx);
     memcpy(kt, ctx->state, ctx->nb * sizeof(uint64_t));
-
-    free(k0);
-    free(k1);
 }
 
 
-void KeyExpandEven(uint64_t* key, uint64_t* kt, kalyna_t* ctx) {
+void KeyExpandEven(const uint64_t* key, uint64_t* kt, kalyna_t* ctx) {
     int i;
-    uint64_t* initial_data = (uint64_t*) malloc(ctx->nk * sizeof(uint64_t));
-    uint64_t* kt_round = (uint64_t*) malloc(ctx->nb * sizeof(uint64_t));
-    uint64_t* tmv = (uint64_t*) malloc(ctx->nb * sizeof(uint64_t));
+    uint64_t initial_data[kNK_512];
+    uint64_t kt_round[kNB_512];
+    uint64_t tmv[kNB_512];
 	size_t round = 0;
 
     memcpy(initial_data, key, ctx->nk * sizeof(uint64_t));
@@ -330,9 +480,9 @@ void KeyExpandEven(uint64_t* key, uint64_t* kt, kalyna_t* ctx) {
         memcpy(ctx->state, initial_data, ctx->nb * sizeof(uint64_t));
 
         AddRoundKeyExpand(kt_round, ctx);
-        EncipherRound(ctx);
+        EncipherRoundTable(ctx);
         XorRoundKeyExpand(kt_round, ctx);
-        EncipherRound(ctx);
+        EncipherRoundTable(ctx);
         AddRoundKeyExpand(kt_round, ctx);
 
         memcpy(ctx->round_keys[round], ctx->state, ctx->nb * sizeof(uint64_t));
@@ -352,9 +502,9 @@ void KeyExpandEven(uint64_t* key, uint64_t* kt, kalyna_t* ctx) {
             memcpy(ctx->state, initial_data + ctx->nb, ctx->nb * sizeof(uint64_t));
 
             AddRoundKeyExpand(kt_round, ctx);
-            EncipherRound(ctx);
+            EncipherRoundTable(ctx);
             XorRoundKeyExpand(kt_round, ctx);
-            EncipherRound(ctx);
+            EncipherRoundTable(ctx);
             AddRoundKeyExpand(kt_round, ctx);
 
             memcpy(ctx->round_keys[round], ctx->state, ctx->nb * sizeof(uint64_t));
@@ -366,10 +516,6 @@ void KeyExpandEven(uint64_t* key, uint64_t* kt, kalyna_t* ctx) {
         ShiftLeft(ctx->nb, tmv);
         Rotate(ctx->nk, initial_data);
     }
-
-    free(initial_data);
-    free(kt_round);
-    free(tmv);
 }
 
 void KeyExpandOdd(kalyna_t* ctx) {
@@ -380,46 +526,139 @@ void KeyExpandOdd(kalyna_t* ctx) {
     }
 }
 
-void KalynaKeyExpand(uint64_t* key, kalyna_t* ctx) {
-    uint64_t* kt = (uint64_t*) malloc(ctx->nb * sizeof(uint64_t));
+void KeyExpandInv(kalyna_t* ctx) {
+    size_t i;
+    for (i = 1; i < ctx->nr; ++i) {
+        memcpy(ctx->state, ctx->round_keys[i], ctx->nb * sizeof(uint64_t));
+        InvMixColumnsTable(ctx);
+        memcpy(ctx->inv_round_keys[i], ctx->state, ctx->nb * sizeof(uint64_t));
+    }
+    /* First and last keys are injected by modular arithmetic, not XOR. */
+    memcpy(ctx->inv_round_keys[0], ctx->round_keys[0], ctx->nb * sizeof(uint64_t));
+    memcpy(ctx->inv_round_keys[ctx->nr], ctx->round_keys[ctx->nr], ctx->nb * sizeof(uint64_t));
+}
+
+void GenericKeyExpand(const uint64_t* key, kalyna_t* ctx) {
+    uint64_t kt[kNB_512];
     KeyExpandKt(key, ctx, kt);
     KeyExpandEven(key, kt, ctx);
     KeyExpandOdd(ctx);
-    free(kt);
+    KeyExpandInv(ctx);
 }
 
 
-void KalynaEncipher(uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext) {
-    int round = 0;
+void GenericEncipher(const uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext) {
+    size_t round = 0;
     memcpy(ctx->state, plaintext, ctx->nb * sizeof(uint64_t));
 
     AddRoundKey(round, ctx);
     for (round = 1; round < ctx->nr; ++round) {
-        EncipherRound(ctx);
+        EncipherRoundTable(ctx);
         XorRoundKey(round, ctx);
     }
-    EncipherRound(ctx);
+    EncipherRoundTable(ctx);
     AddRoundKey(ctx->nr, ctx);
 
     memcpy(ciphertext, ctx->state, ctx->nb * sizeof(uint64_t));
 }
 
-void KalynaDecipher(uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext) {
+void GenericDecipher(const uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext) {
     int round = ctx->nr;
     memcpy(ctx->state, ciphertext, ctx->nb * sizeof(uint64_t));
 
     SubRoundKey(round, ctx);
+    /* Equivalent inverse cipher: InvMixColumns is moved to the front so that
+     * the rest of the rounds fit the lookup tables. */
+    InvMixColumnsTable(ctx);
     for (round = ctx->nr - 1; round > 0; --round) {
-        DecipherRound(ctx);
-        XorRoundKey(round, ctx);
+        DecipherRoundTable(ctx);
+        XorRoundKeyExpand(ctx->inv_round_keys[round], ctx);
     }
-    DecipherRound(ctx);
+    InvSubBytes(ctx);
+    InvShiftRows(ctx);
     SubRoundKey(0, ctx);
 
     memcpy(plaintext, ctx->state, ctx->nb * sizeof(uint64_t));
 }
 
 
+void GenericEncipherBlocks(const uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext, size_t nblocks) {
+    size_t i;
+    for (i = 0; i < nblocks; ++i) {
+        ctx->encipher(plaintext + i * ctx->nb, ctx, ciphertext + i * ctx->nb);
+    }
+}
+
+void GenericDecipherBlocks(const uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext, size_t nblocks) {
+    size_t i;
+    for (i = 0; i < nblocks; ++i) {
+        ctx->decipher(ciphertext + i * ctx->nb, ctx, plaintext + i * ctx->nb);
+    }
+}
+
+
+void KalynaKeyExpand(uint64_t* key, kalyna_t* ctx) {
+    ctx->key_expand(key, ctx);
+}
+
+void GenericKeyExpandBatch(const uint64_t* keys, kalyna_t** ctxs, size_t count) {
+    size_t i;
+    for (i = 0; i < count; ++i) {
+        ctxs[i]->key_expand(keys + i * ctxs[i]->nk, ctxs[i]);
+    }
+}
+
+int KalynaKeyExpandBatch(const uint64_t* keys, kalyna_t** ctxs, size_t count) {
+    size_t i;
+    if (count == 0)
+        return 0;
+    for (i = 1; i < count; ++i) {
+        if (ctxs[i]->nb != ctxs[0]->nb || ctxs[i]->nk != ctxs[0]->nk)
+            return -1;
+    }
+    ctxs[0]->key_expand_batch(keys, ctxs, count);
+    return 0;
+}
+
+void KalynaEncipher(uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext) {
+    ctx->encipher(plaintext, ctx, ciphertext);
+}
+
+void KalynaDecipher(uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext) {
+    ctx->decipher(ciphertext, ctx, plaintext);
+}
+
+void KalynaEncipherBlocks(const uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext, size_t nblocks) {
+    ctx->encipher_blocks(plaintext, ctx, ciphertext, nblocks);
+}
+
+void KalynaDecipherBlocks(const uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext, size_t nblocks) {
+    ctx->decipher_blocks(ciphertext, ctx, plaintext, nblocks);
+}
+
+const kalyna_schedule_t* KalynaGetSchedule(const kalyna_t* ctx) {
+    return &ctx->key_schedule;
+}
+
+void KalynaScheduleEncipher(const uint64_t* plaintext, const kalyna_schedule_t* schedule, uint64_t* ciphertext) {
+    schedule->encipher(plaintext, schedule, ciphertext);
+}
+
+void KalynaScheduleDecipher(const uint64_t* ciphertext, const kalyna_schedule_t* schedule, uint64_t* plaintext) {
+    schedule->decipher(ciphertext, schedule, plaintext);
+}
+
+void KalynaScheduleEncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule,
+                                  uint64_t* ciphertext, size_t nblocks) {
+    schedule->encipher_blocks(plaintext, schedule, ciphertext, nblocks);
+}
+
+void KalynaScheduleDecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule,
+                                  uint64_t* plaintext, size_t nblocks) {
+    schedule->decipher_blocks(ciphertext, schedule, plaintext, nblocks);
+}
+
+
 uint8_t* WordsToBytes(size_t length, uint64_t* words) {
     int i;
 	uint8_t* bytes;
@@ -17,15 +17,115 @@ Authors: Ruslan Kiianchuk, Ruslan Mordvinov, Roman Oliynykov
 typedef unsigned char uint8_t;
 typedef unsigned long long uint64_t;
 
+struct kalyna_s;
+struct kalyna_schedule_s;
+
+/*!
+ * Processor features reported by KalynaCpuFeatures().
+ */
+#define KALYNA_CPU_SSSE3   0x01
+#define KALYNA_CPU_AVX2    0x02
+#define KALYNA_CPU_AVX512  0x04  /**< AVX-512 F and BW. */
+#define KALYNA_CPU_GFNI    0x08
+
+/*!
+ * Implementations of the cipher. Every backend produces the same results.
+ */
+typedef enum {
+    KALYNA_BACKEND_AUTO = 0,  /**< Fastest backend the processor supports (tables). */
+    KALYNA_BACKEND_GENERIC,  /**< Generic table-driven rounds on the context state,
+                                  any variant (portable). */
+    KALYNA_BACKEND_TABLES,  /**< Variant specialized table kernels (portable). */
+    KALYNA_BACKEND_AVX2,  /**< Table kernels, AVX2 multi-block kernels. Experimental:
+                               slower than KALYNA_BACKEND_TABLES, never chosen by AUTO. */
+    KALYNA_BACKEND_GFNI,  /**< Table kernels, AVX2 and GFNI multi-block kernels.
+                               Experimental, like KALYNA_BACKEND_AVX2. */
+    KALYNA_BACKEND_BITSLICED  /**< Bitsliced constant-time kernels for enciphering and
+                                   deciphering (modes included), table key expansion. */
+} kalyna_backend_t;
+
+/*!
+ * Enciphering or deciphering kernel transforming a single block.
+ */
+typedef void (*kalyna_block_fn)(const uint64_t* in, struct kalyna_s* ctx, uint64_t* out);
+
+/*!
+ * Enciphering or deciphering kernel transforming `nblocks` consecutive blocks.
+ */
+typedef void (*kalyna_blocks_fn)(const uint64_t* in, struct kalyna_s* ctx, uint64_t* out, size_t nblocks);
+
+/*!
+ * Key expansion kernel computing all round keys.
+ */
+typedef void (*kalyna_key_fn)(const uint64_t* key, struct kalyna_s* ctx);
+
+/*!
+ * Key expansion kernel computing the round keys of `count` keys into
+ * contexts of the same variant.
+ */
+typedef void (*kalyna_key_batch_fn)(const uint64_t* keys, struct kalyna_s** ctxs, size_t count);
+
+/*!
+ * Enciphering or deciphering kernel transforming a single block with a
+ * read-only key schedule.
+ */
+typedef void (*kalyna_schedule_block_fn)(const uint64_t* in, const struct kalyna_schedule_s* schedule, uint64_t* out);
+
+/*!
+ * Enciphering or deciphering kernel transforming `nblocks` consecutive blocks
+ * with a read-only key schedule.
+ */
+typedef void (*kalyna_schedule_blocks_fn)(const uint64_t* in, const struct kalyna_schedule_s* schedule,
+                                          uint64_t* out, size_t nblocks);
+
+/*!
+ * Expanded key, immutable after KalynaKeyExpand(). Functions taking a
+ * schedule keep their state in registers and on the stack, so one schedule
+ * may be used by any number of threads at once.
+ */
+typedef struct kalyna_schedule_s {
+    size_t nb;  /**< Number of 64-bit words in enciphering block. */
+    size_t nk;  /**< Number of 64-bit words in key. */
+    size_t nr;  /**< Number of enciphering rounds. */
+    const uint64_t* round_keys;  /**< Round keys in round order, key `r` at
+                                   `round_keys + r * nb`. Compact schedules:
+                                   even keys only, key `2j` at
+                                   `round_keys + j * nb`. */
+    const uint64_t* inv_round_keys;  /**< Round keys of the table-driven
+                                       deciphering, same layout. NULL for
+                                       compact schedules. */
+    kalyna_schedule_block_fn encipher;  /**< Enciphering kernel. */
+    kalyna_schedule_block_fn decipher;  /**< Deciphering kernel. */
+    kalyna_schedule_blocks_fn encipher_blocks;  /**< Multi-block enciphering kernel. */
+    kalyna_schedule_blocks_fn decipher_blocks;  /**< Multi-block deciphering kernel. */
+} kalyna_schedule_t;
+
 /*!
  * Context to store Kalyna cipher parameters.
  */
-typedef struct {
+typedef struct kalyna_s {
     size_t nb;  /**< Number of 64-bit words in enciphering block. */ 
     size_t nk;  /**< Number of 64-bit words in key. */
     size_t nr;  /**< Number of enciphering rounds. */
     uint64_t* state;  /**< Current cipher state. */
     uint64_t** round_keys;  /**< Round key computed from enciphering key. */
+    uint64_t** inv_round_keys;  /**< Round keys with InvMixColumns applied, 
+                                  used by the table-driven deciphering. */
+    kalyna_block_fn encipher;  /**< Enciphering kernel for this variant. */
+    kalyna_block_fn decipher;  /**< Deciphering kernel for this variant. */
+    kalyna_key_fn key_expand;  /**< Key expansion kernel for this variant. */
+    kalyna_blocks_fn encipher_blocks;  /**< Multi-block enciphering kernel. */
+    kalyna_blocks_fn decipher_blocks;  /**< Multi-block deciphering kernel. */
+    kalyna_backend_t backend;  /**< Backend the kernels were selected from. */
+    uint64_t* schedule;  /**< Round keys in round order, key `r` at
+                           `schedule + r * nb`. `round_keys[r]` points here. */
+    uint64_t* inv_schedule;  /**< Same for `inv_round_keys`. */
+    void* memory;  /**< Allocation holding the context, the state and the
+                     schedules (64-byte aligned within). NULL for contexts in
+                     caller storage, see KalynaInitBuffer(). */
+    kalyna_schedule_t key_schedule;  /**< Read-only view of the schedules,
+                                       see KalynaGetSchedule(). */
+    kalyna_key_batch_fn key_expand_batch;  /**< Multi-key expansion kernel. */
 } kalyna_t;
 
 
@@ -43,7 +143,83 @@ typedef struct {
 kalyna_t* KalynaInit(size_t block_size, size_t key_size);
 
 /*!
- * Delete Kalyna cipher context and free used memory.
+ * Round key of the schedule computed by KalynaKeyExpand(). Equivalent to
+ * `ctx->round_keys[round]`, without the pointer indirection.
+ *
+ * @param ctx Kalyna cipher context.
+ * @param round Round key index, 0 to `ctx->nr`.
+ * @return Pointer to `ctx->nb` words of contiguous round key storage.
+ */
+const uint64_t* KalynaRoundKey(const kalyna_t* ctx, size_t round);
+
+/*!
+ * Select the implementation used by cipher context `ctx`. KalynaInit()
+ * selects KALYNA_BACKEND_AUTO unless the KALYNA_BACKEND environment variable
+ * names another backend ("generic", "tables", "avx2" or "gfni"). Round keys
+ * are shared by all backends, so the backend may be changed after key
+ * expansion.
+ *
+ * @param ctx Kalyna cipher context.
+ * @param backend Backend to use.
+ * @return Zero in case of success, -1 if the processor does not support the
+ * backend (the context is left unchanged).
+ */
+int KalynaSetBackend(kalyna_t* ctx, kalyna_backend_t backend);
+
+/*!
+ * Check if the processor supports a backend.
+ *
+ * @param backend Backend to check.
+ * @return 1 if KalynaSetBackend() accepts `backend`, 0 otherwise.
+ */
+int KalynaBackendSupported(kalyna_backend_t backend);
+
+/*!
+ * Name of a backend, as accepted in the KALYNA_BACKEND environment variable.
+ *
+ * @param backend Backend.
+ * @return Static string.
+ */
+const char* KalynaBackendName(kalyna_backend_t backend);
+
+/*!
+ * Processor features relevant to the cipher. The processor is probed once by
+ * the compiler runtime at program start, so this is cheap.
+ *
+ * @return Bitwise OR of KALYNA_CPU_* flags, 0 on processors other than x86.
+ */
+unsigned KalynaCpuFeatures();
+
+/*!
+ * Bytes of storage KalynaInitBuffer() needs for a variant, including
+ * padding for any buffer alignment.
+ *
+ * @param block_size Enciphering block bit size (128, 256 or 512).
+ * @param key_size Enciphering key bit size.
+ * @return Storage size in bytes, 0 for unsupported sizes.
+ */
+size_t KalynaContextSize(size_t block_size, size_t key_size);
+
+/*!
+ * Initialize Kalyna parameters and create cipher context in caller provided
+ * storage, without allocating. The buffer must stay valid while the context
+ * is used and is not moved: the context holds pointers into it, so in shared
+ * memory it is only valid at the address it was initialized at.
+ * KalynaDelete() on the context does not free the buffer.
+ *
+ * @param buffer Storage of at least KalynaContextSize() bytes.
+ * @param buffer_size Size of `buffer` in bytes.
+ * @param block_size Enciphering block bit size (128, 256 or 512).
+ * @param key_size Enciphering key bit size. Must be equal or double the
+ * block bit size.
+ * @return Pointer to Kalyna context inside `buffer`. NULL for unsupported
+ * sizes or a too small buffer.
+ */
+kalyna_t* KalynaInitBuffer(void* buffer, size_t buffer_size, size_t block_size, size_t key_size);
+
+/*!
+ * Delete Kalyna cipher context and free used memory. Contexts from
+ * KalynaInitBuffer() are only cleared, the caller owns their storage.
  *
  * @param ctx Kalyna cipher context.
  * @return Zero in case of success.
@@ -59,6 +235,22 @@ int KalynaDelete(kalyna_t* ctx);
  */
 void KalynaKeyExpand(uint64_t* key, kalyna_t* ctx);
 
+/*!
+ * Compute round keys of several enciphering keys at once, see
+ * KalynaKeyExpand(). The block and key sizes are checked once and each key
+ * is then expanded by the specialized kernel of the variant, one after
+ * another. This is a convenience only, no faster than KalynaKeyExpand()
+ * per key.
+ *
+ * @param keys `count` enciphering keys of Nk words each, one after another.
+ * @param ctxs `count` initialized contexts of the same block and key size;
+ * round keys of key `i` are stored in `ctxs[i]`.
+ * @param count Number of keys.
+ * @return Zero in case of success, -1 if the contexts differ in block or
+ * key size (nothing is expanded).
+ */
+int KalynaKeyExpandBatch(const uint64_t* keys, kalyna_t** ctxs, size_t count);
+
 /*!
  * Encipher plaintext using Kalyna symmetric block cipher.
  * KalynaInit() function with appropriate block and enciphering key sizes must
@@ -83,5 +275,592 @@ void KalynaEncipher(uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext);
  */
 void KalynaDecipher(uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext);
 
+/*!
+ * Bytes of caller storage needed by KalynaCompactScheduleInit().
+ *
+ * @param block_size Enciphering block bit size (128, 256 or 512).
+ * @param key_size Enciphering key bit size.
+ * @return Buffer size, or 0 for unsupported sizes.
+ */
+size_t KalynaCompactScheduleSize(size_t block_size, size_t key_size);
+
+/*!
+ * Expand `key` into a compact read-only schedule in caller storage. Only the
+ * even round keys are stored, about a quarter of the round keys kept by a
+ * context: odd keys are rotated from them inside the round loop, and the
+ * deciphering kernel applies InvMixColumns to each round key on the fly,
+ * so deciphering is slower than with KalynaGetSchedule(). Use with the
+ * KalynaSchedule* functions; thread-safe like any schedule.
+ *
+ * @param buffer Storage of at least KalynaCompactScheduleSize() bytes.
+ * @param buffer_size Size of `buffer` in bytes.
+ * @param block_size Enciphering block bit size (128, 256 or 512).
+ * @param key_size Enciphering key bit size.
+ * @param key Enciphering key of Nk words.
+ * @return Schedule inside `buffer`, or NULL for unsupported sizes or a too
+ * small buffer.
+ */
+kalyna_schedule_t* KalynaCompactScheduleInit(void* buffer, size_t buffer_size, size_t block_size,
+                                             size_t key_size, const uint64_t* key);
+
+/*!
+ * Clear the round keys of a compact schedule. The buffer stays owned by
+ * the caller.
+ *
+ * @param schedule Schedule from KalynaCompactScheduleInit().
+ */
+void KalynaCompactScheduleWipe(kalyna_schedule_t* schedule);
+
+/*!
+ * Encipher a few blocks with a key used only once, without a context. Round
+ * keys are generated just before the round that uses them and no schedule
+ * is stored, which is cheaper than KalynaKeyExpand() plus KalynaEncipher()
+ * for one or two blocks. Not for deciphering, which uses the round keys in
+ * reverse order.
+ *
+ * @param block_size Enciphering block bit size (128, 256 or 512).
+ * @param key_size Enciphering key bit size.
+ * @param key Enciphering key of Nk words.
+ * @param plaintext Plaintext of length `nblocks` * Nb words.
+ * @param ciphertext The result of enciphering, may be equal to `plaintext`.
+ * @param nblocks Number of blocks.
+ * @return Zero in case of success, -1 for unsupported sizes.
+ */
+int KalynaEncipherOneShot(size_t block_size, size_t key_size, const uint64_t* key,
+                          const uint64_t* plaintext, uint64_t* ciphertext, size_t nblocks);
+
+/*!
+ * Encipher multiple consecutive blocks with the multi-block kernel of the
+ * selected backend (see KalynaSetBackend()). Produces the same result as
+ * calling KalynaEncipher() for each block.
+ *
+ * @param plaintext Plaintext of length `nblocks` * Nb words.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param ciphertext The result of enciphering, may be equal to `plaintext`.
+ * @param nblocks Number of blocks.
+ */
+void KalynaEncipherBlocks(const uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext, size_t nblocks);
+
+/*!
+ * Decipher multiple consecutive blocks. See KalynaEncipherBlocks().
+ *
+ * @param ciphertext Enciphered data of length `nblocks` * Nb words.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param plaintext The result of deciphering, may be equal to `ciphertext`.
+ * @param nblocks Number of blocks.
+ */
+void KalynaDecipherBlocks(const uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext, size_t nblocks);
+
+/*!
+ * Encipher or decipher in the counter (gamming) mode of DSTU 7624: the
+ * keystream block i is E(E(IV) + i + 1) with a full block width little
+ * endian counter. Data bytes follow the little endian order of block words.
+ * Enciphering and deciphering are the same operation.
+ *
+ * @param input Data of `length` bytes.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param iv Initialization vector of Nb words.
+ * @param output The result, may be equal to `input`.
+ * @param length Data length in bytes, not necessarily a multiple of blocks.
+ */
+void KalynaCtrCrypt(const uint8_t* input, kalyna_t* ctx, const uint64_t* iv, uint8_t* output, size_t length);
+
+/*!
+ * Encipher or decipher `length` bytes of a counter mode stream starting at
+ * byte `offset` of it, see KalynaCtrCrypt(). The starting counter is
+ * computed in constant time, so only the blocks touched are enciphered.
+ * Only the key schedule is read, so threads may process disjoint ranges of
+ * one stream with one context.
+ *
+ * @param input Data of `length` bytes, at `offset` of the stream.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param iv Initialization vector of Nb words.
+ * @param offset Byte offset of `input` in the stream.
+ * @param output The result, may be equal to `input`.
+ * @param length Data length in bytes.
+ */
+void KalynaCtrCryptAt(const uint8_t* input, kalyna_t* ctx, const uint64_t* iv, uint64_t offset,
+                      uint8_t* output, size_t length);
+
+/*!
+ * Encipher consecutive blocks in the cipher block chaining mode. Each block
+ * depends on the one before, so blocks are enciphered one at a time; see
+ * KalynaCbcEncipherStreams() for many messages at once.
+ *
+ * @param plaintext Plaintext of length `nblocks` * Nb words, padded with
+ * KalynaPad() if needed.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param iv Initialization vector of Nb words.
+ * @param ciphertext The result of enciphering, may be equal to `plaintext`.
+ * @param nblocks Number of blocks.
+ */
+void KalynaCbcEncipher(const uint64_t* plaintext, kalyna_t* ctx, const uint64_t* iv, uint64_t* ciphertext,
+                       size_t nblocks);
+
+/*!
+ * Decipher consecutive blocks in the cipher block chaining mode. Blocks are
+ * deciphered in batches with the multi-block kernel, then XORed with the
+ * ciphertext blocks before them.
+ *
+ * @param ciphertext Enciphered data of length `nblocks` * Nb words.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param iv Initialization vector of Nb words.
+ * @param plaintext The result of deciphering, equal to `ciphertext` or not
+ * overlapping it.
+ * @param nblocks Number of blocks.
+ */
+void KalynaCbcDecipher(const uint64_t* ciphertext, kalyna_t* ctx, const uint64_t* iv, uint64_t* plaintext,
+                       size_t nblocks);
+
+/*!
+ * One message of KalynaCbcEncipherStreams().
+ */
+typedef struct {
+    kalyna_t* ctx;  /**< Context with the message key, only its schedule is read. */
+    const uint64_t* iv;  /**< Initialization vector of Nb words. */
+    const uint64_t* plaintext;  /**< Plaintext of `nblocks` blocks. */
+    uint64_t* ciphertext;  /**< Result, may be equal to `plaintext`. */
+    size_t nblocks;
+} kalyna_cbc_stream_t;
+
+/*!
+ * CBC encipher many independent messages at once. Blocks of different
+ * messages do not depend on each other, so messages advance in lockstep
+ * through the interleaved multi-block rounds, each with its own key and
+ * IV. A message that ends is replaced by the next one, so messages may
+ * have different lengths; once none are left the remaining ones keep
+ * advancing together, fewer at a time, and only a last message running
+ * alone is serial. The result matches KalynaCbcEncipher() for each.
+ * The lockstep rounds use the table kernels; if any context uses another
+ * backend (see KalynaSetBackend()), every message is enciphered with
+ * KalynaCbcEncipher() in turn instead.
+ *
+ * @param streams Messages, all keyed for the same block and key size.
+ * @param count Number of messages.
+ * @return Zero in case of success, -1 if the variants differ.
+ */
+int KalynaCbcEncipherStreams(const kalyna_cbc_stream_t* streams, size_t count);
+
+/*!
+ * Length of a message of `length` bytes after KalynaPad().
+ *
+ * @param length Message length in bytes.
+ * @param block_size Enciphering block bit size.
+ * @return Padded length, a multiple of the block size greater than `length`.
+ */
+size_t KalynaPaddedLength(size_t length, size_t block_size);
+
+/*!
+ * Pad a message as DSTU 7624 specifies: a 0x80 byte, then zero bytes up to
+ * the block boundary. Padding is always added, a full block for messages
+ * that already end on a boundary.
+ *
+ * @param data Message with room for KalynaPaddedLength() bytes.
+ * @param length Message length in bytes.
+ * @param block_size Enciphering block bit size.
+ * @return Padded length.
+ */
+size_t KalynaPad(uint8_t* data, size_t length, size_t block_size);
+
+/*!
+ * Find the message length of padded data, see KalynaPad(). Errors tell an
+ * attacker about the plaintext: authenticate ciphertexts before deciphering.
+ *
+ * @param data Deciphered padded data.
+ * @param length Padded length in bytes.
+ * @param block_size Enciphering block bit size.
+ * @param unpadded Message length without the padding.
+ * @return Zero in case of success, -1 if the padding is invalid.
+ */
+int KalynaUnpad(const uint8_t* data, size_t length, size_t block_size, size_t* unpadded);
+
+/*!
+ * Read-only key schedule of a context. It points into the context, stays
+ * valid until KalynaDelete() and reflects the last KalynaKeyExpand() and
+ * KalynaSetBackend(). Do not expand a new key while other threads use it.
+ *
+ * @param ctx Kalyna cipher context.
+ * @return Key schedule of `ctx`.
+ */
+const kalyna_schedule_t* KalynaGetSchedule(const kalyna_t* ctx);
+
+/*!
+ * Encipher a block with a read-only key schedule. Thread-safe: nothing but
+ * `ciphertext` is written.
+ *
+ * @param plaintext Plaintext of length Nb words.
+ * @param schedule Key schedule from KalynaGetSchedule().
+ * @param ciphertext The result of enciphering.
+ */
+void KalynaScheduleEncipher(const uint64_t* plaintext, const kalyna_schedule_t* schedule, uint64_t* ciphertext);
+
+/*!
+ * Decipher a block with a read-only key schedule. Thread-safe: nothing but
+ * `plaintext` is written.
+ *
+ * @param ciphertext Enciphered data of length Nb words.
+ * @param schedule Key schedule from KalynaGetSchedule().
+ * @param plaintext The result of deciphering.
+ */
+void KalynaScheduleDecipher(const uint64_t* ciphertext, const kalyna_schedule_t* schedule, uint64_t* plaintext);
+
+/*!
+ * Encipher consecutive blocks with a read-only key schedule, see
+ * KalynaEncipherBlocks().
+ *
+ * @param plaintext Plaintext of length `nblocks` * Nb words.
+ * @param schedule Key schedule from KalynaGetSchedule().
+ * @param ciphertext The result of enciphering, may be equal to `plaintext`.
+ * @param nblocks Number of blocks.
+ */
+void KalynaScheduleEncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule,
+                                  uint64_t* ciphertext, size_t nblocks);
+
+/*!
+ * Decipher consecutive blocks with a read-only key schedule, see
+ * KalynaDecipherBlocks().
+ *
+ * @param ciphertext Enciphered data of length `nblocks` * Nb words.
+ * @param schedule Key schedule from KalynaGetSchedule().
+ * @param plaintext The result of deciphering, may be equal to `ciphertext`.
+ * @param nblocks Number of blocks.
+ */
+void KalynaScheduleDecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule,
+                                  uint64_t* plaintext, size_t nblocks);
+
+/*!
+ * Bounded thread-safe cache of key schedules by master key, see
+ * KalynaCacheCreate().
+ */
+typedef struct kalyna_cache_s kalyna_cache_t;
+
+/*!
+ * Counters of a schedule cache.
+ */
+typedef struct {
+    uint64_t hits;  /**< Acquisitions served from the cache. */
+    uint64_t misses;  /**< Acquisitions that expanded the key. */
+    uint64_t evictions;  /**< Schedules wiped to make room for another key. */
+} kalyna_cache_stats_t;
+
+/*!
+ * Create a cache of up to `capacity` expanded key schedules of any variant.
+ * All storage is allocated here: misses expand the key into a slot evicted
+ * in CLOCK order and wiped, hits only take a lock.
+ *
+ * @param capacity Number of schedules kept.
+ * @return Cache, or NULL if `capacity` is zero or allocation failed.
+ */
+kalyna_cache_t* KalynaCacheCreate(size_t capacity);
+
+/*!
+ * Wipe all cached round keys and master keys and free the cache. No
+ * schedule may be in use.
+ *
+ * @param cache Cache from KalynaCacheCreate().
+ */
+void KalynaCacheDestroy(kalyna_cache_t* cache);
+
+/*!
+ * Schedule of `key`, expanded on a miss. The schedule is read-only and not
+ * evicted until released, so it may be used with the KalynaSchedule*
+ * functions by any thread in between.
+ *
+ * @param cache Cache from KalynaCacheCreate().
+ * @param block_size Enciphering block bit size (128, 256 or 512).
+ * @param key_size Enciphering key bit size.
+ * @param key Enciphering key of Nk words.
+ * @return Schedule to pass to KalynaCacheRelease(), or NULL for unsupported
+ * sizes or when every cached schedule is in use.
+ */
+const kalyna_schedule_t* KalynaCacheAcquire(kalyna_cache_t* cache, size_t block_size, size_t key_size,
+                                            const uint64_t* key);
+
+/*!
+ * Release a schedule from KalynaCacheAcquire(), allowing its eviction.
+ *
+ * @param cache Cache the schedule was acquired from.
+ * @param schedule Acquired schedule.
+ */
+void KalynaCacheRelease(kalyna_cache_t* cache, const kalyna_schedule_t* schedule);
+
+/*!
+ * Read the hit, miss and eviction counters.
+ *
+ * @param cache Cache from KalynaCacheCreate().
+ * @param stats Receives the counters.
+ */
+void KalynaCacheStats(kalyna_cache_t* cache, kalyna_cache_stats_t* stats);
+
+/*!
+ * Current key schedule of a rotating key, readable without locks, see
+ * KalynaRegistryCreate().
+ */
+typedef struct kalyna_registry_s kalyna_registry_t;
+
+/*!
+ * Create a registry publishing the schedule of `key`. Readers take the
+ * current schedule wait-free; schedules replaced by KalynaRegistryRotate()
+ * are wiped and freed once no reader can hold them (epoch-based
+ * reclamation).
+ *
+ * @param block_size Enciphering block bit size (128, 256 or 512).
+ * @param key_size Enciphering key bit size.
+ * @param key Initial enciphering key of Nk words.
+ * @param max_readers Number of reader slots, see KalynaRegistryEnter().
+ * @return Registry, or NULL for unsupported sizes or if allocation failed.
+ */
+kalyna_registry_t* KalynaRegistryCreate(size_t block_size, size_t key_size, const uint64_t* key,
+                                        size_t max_readers);
+
+/*!
+ * Wipe and free all schedules and the registry. No reader may be inside.
+ *
+ * @param registry Registry from KalynaRegistryCreate().
+ */
+void KalynaRegistryDestroy(kalyna_registry_t* registry);
+
+/*!
+ * Take the current schedule. Wait-free. The schedule stays valid until
+ * KalynaRegistryExit() with the same `reader`, even if the key is rotated
+ * meanwhile. Each reader slot is used by one thread at a time and is not
+ * entered again before exiting.
+ *
+ * @param registry Registry from KalynaRegistryCreate().
+ * @param reader Reader slot below `max_readers`, typically one per thread.
+ * @return Read-only schedule for the KalynaSchedule* functions.
+ */
+const kalyna_schedule_t* KalynaRegistryEnter(kalyna_registry_t* registry, size_t reader);
+
+/*!
+ * Drop the schedule taken by KalynaRegistryEnter(). Wait-free.
+ *
+ * @param registry Registry from KalynaRegistryCreate().
+ * @param reader Reader slot passed to KalynaRegistryEnter().
+ */
+void KalynaRegistryExit(kalyna_registry_t* registry, size_t reader);
+
+/*!
+ * Expand `key` and publish it as the current schedule. Readers are never
+ * blocked; concurrent rotations are serialized. The old schedule is
+ * reclaimed now or by a later rotation or KalynaRegistryReclaim().
+ *
+ * @param registry Registry from KalynaRegistryCreate().
+ * @param key New enciphering key of Nk words.
+ * @return Zero in case of success, -1 if allocation failed.
+ */
+int KalynaRegistryRotate(kalyna_registry_t* registry, const uint64_t* key);
+
+/*!
+ * Wipe and free the replaced schedules no reader holds anymore.
+ *
+ * @param registry Registry from KalynaRegistryCreate().
+ * @return Number of replaced schedules still held by readers.
+ */
+size_t KalynaRegistryReclaim(kalyna_registry_t* registry);
+
+/*!
+ * Bytes of the snapshot of `count` schedules written by KalynaSnapshotWrite().
+ *
+ * @param schedules Full key schedules, e.g. from KalynaGetSchedule().
+ * @param count Number of schedules.
+ * @return Snapshot size in bytes.
+ */
+size_t KalynaSnapshotSize(const kalyna_schedule_t* const* schedules, size_t count);
+
+/*!
+ * Write expanded schedules, including the inverse cipher round keys, to a
+ * versioned and checksummed snapshot that KalynaSnapshotOpen() uses in place,
+ * e.g. from a mapped file. The snapshot holds key material: store it like
+ * the keys themselves.
+ *
+ * @param schedules Full key schedules (not compact ones).
+ * @param count Number of schedules.
+ * @param buffer Word aligned storage of KalynaSnapshotSize() bytes.
+ * @param buffer_size Size of `buffer` in bytes.
+ * @return Zero in case of success, -1 for a too small or misaligned buffer
+ * or compact schedules.
+ */
+int KalynaSnapshotWrite(const kalyna_schedule_t* const* schedules, size_t count, void* buffer, size_t buffer_size);
+
+/*!
+ * Check a snapshot and fill `schedules` with read-only schedules pointing
+ * into it, without recomputing any round key. The snapshot must stay mapped
+ * and unchanged while they are used.
+ *
+ * @param data Word aligned snapshot from KalynaSnapshotWrite().
+ * @param size Size of `data` in bytes.
+ * @param schedules Receives the schedules.
+ * @param capacity Number of elements of `schedules`.
+ * @return Number of schedules, or -1 if the snapshot is of another version
+ * or byte order, truncated, corrupted or holds more than `capacity`.
+ */
+int KalynaSnapshotOpen(const void* data, size_t size, kalyna_schedule_t* schedules, size_t capacity);
+
+/*!
+ * Key schedule store in shared memory, see KalynaStoreCreate().
+ */
+typedef struct kalyna_store_s kalyna_store_t;
+
+/*!
+ * Bytes of a store of `capacity` schedules of one variant.
+ *
+ * @param capacity Number of schedules, rounded up to a power of two. Keep
+ * it about twice the number stored for short lookups.
+ * @param block_size Enciphering block bit size (128, 256 or 512).
+ * @param key_size Enciphering key bit size.
+ * @return Region size in bytes, or 0 for unsupported sizes.
+ */
+size_t KalynaStoreSize(size_t capacity, size_t block_size, size_t key_size);
+
+/*!
+ * Create an empty store in `memory`, typically a MAP_SHARED mapping of a
+ * memfd or shm object that worker processes map read-only. The store holds
+ * no pointers, so each process may map it at any address. Only one thread
+ * of one process (the writer) may call KalynaStorePut() and
+ * KalynaStoreRemove(); lookups need no locks.
+ *
+ * @param memory Region of KalynaStoreSize() bytes, 64-byte aligned.
+ * @param size Size of `memory` in bytes.
+ * @param capacity Capacity passed to KalynaStoreSize().
+ * @param block_size Enciphering block bit size (128, 256 or 512).
+ * @param key_size Enciphering key bit size.
+ * @return Store at `memory`, or NULL for unsupported sizes or a too small
+ * or misaligned region.
+ */
+kalyna_store_t* KalynaStoreCreate(void* memory, size_t size, size_t capacity, size_t block_size, size_t key_size);
+
+/*!
+ * Check the header of a store mapped by a reader.
+ *
+ * @param memory Mapping of a region set up by KalynaStoreCreate().
+ * @param size Size of the mapping in bytes.
+ * @return Store at `memory`, or NULL if it is not a store of this version.
+ */
+const kalyna_store_t* KalynaStoreAttach(const void* memory, size_t size);
+
+/*!
+ * Expand `key` into the store under `id`, replacing the schedule stored
+ * under it. Readers switch to the new schedule with their next lookup.
+ * Writer only.
+ *
+ * @param store Store from KalynaStoreCreate().
+ * @param id Schedule id, neither 0 nor ~0.
+ * @param key Enciphering key of Nk words.
+ * @return Zero in case of success, -1 for an invalid id or a full store.
+ */
+int KalynaStorePut(kalyna_store_t* store, uint64_t id, const uint64_t* key);
+
+/*!
+ * Remove and wipe the schedule stored under `id`. Writer only.
+ *
+ * @param store Store from KalynaStoreCreate().
+ * @param id Schedule id.
+ * @return Zero in case of success, -1 if `id` is not stored.
+ */
+int KalynaStoreRemove(kalyna_store_t* store, uint64_t id);
+
+/*!
+ * Look up the schedule stored under `id` without locks. `schedule` points
+ * into the store; the writer may replace it while it is used, so after use
+ * KalynaStoreValidate() tells if the results may be kept.
+ *
+ * @param store Store from KalynaStoreCreate() or KalynaStoreAttach().
+ * @param id Schedule id.
+ * @param schedule Receives the read-only schedule.
+ * @param generation Receives the generation to validate against.
+ * @return Zero in case of success, -1 if `id` is not stored.
+ */
+int KalynaStoreLookup(const kalyna_store_t* store, uint64_t id, kalyna_schedule_t* schedule, uint64_t* generation);
+
+/*!
+ * Check that the round keys of a looked up schedule were not rewritten or
+ * wiped since KalynaStoreLookup(). Results computed with a schedule that
+ * fails validation must be discarded and the lookup repeated.
+ *
+ * @param store Store the schedule was looked up in.
+ * @param schedule Schedule from KalynaStoreLookup().
+ * @param generation Generation from KalynaStoreLookup().
+ * @return 1 if the results are valid, 0 otherwise.
+ */
+int KalynaStoreValidate(const kalyna_store_t* store, const kalyna_schedule_t* schedule, uint64_t generation);
+
+/*!
+ * Pool of contexts of one variant, see KalynaPoolCreate().
+ */
+typedef struct kalyna_pool_s kalyna_pool_t;
+
+/*!
+ * Create a pool handing out contexts from slabs of `slab_contexts` cache
+ * line aligned slots. Acquiring and releasing are O(1); only a new slab
+ * allocates. A pool is not thread-safe: use one pool per thread.
+ *
+ * @param block_size Enciphering block bit size (128, 256 or 512).
+ * @param key_size Enciphering key bit size.
+ * @param slab_contexts Contexts per slab.
+ * @return Pool, or NULL for unsupported sizes or if allocation failed.
+ */
+kalyna_pool_t* KalynaPoolCreate(size_t block_size, size_t key_size, size_t slab_contexts);
+
+/*!
+ * Wipe all contexts and free the pool with its slabs.
+ *
+ * @param pool Pool from KalynaPoolCreate().
+ */
+void KalynaPoolDestroy(kalyna_pool_t* pool);
+
+/*!
+ * Take an initialized context from the pool, adding a slab if none is free.
+ *
+ * @param pool Pool from KalynaPoolCreate().
+ * @return Context to expand a key into, or NULL if allocation failed.
+ */
+kalyna_t* KalynaPoolAcquire(kalyna_pool_t* pool);
+
+/*!
+ * Wipe a context and return it to the pool. Use instead of KalynaDelete().
+ *
+ * @param pool Pool the context was acquired from.
+ * @param ctx Context from KalynaPoolAcquire().
+ */
+void KalynaPoolRelease(kalyna_pool_t* pool, kalyna_t* ctx);
+
+/*!
+ * Wipe and release every context of the pool at once, keeping the slabs.
+ * Contexts acquired before must not be used anymore.
+ *
+ * @param pool Pool from KalynaPoolCreate().
+ */
+void KalynaPoolReleaseAll(kalyna_pool_t* pool);
+
+/*!
+ * Encipher multiple blocks with the bitsliced constant-time implementation.
+ * Blocks are processed 64 at a time with no table lookups, branches or
+ * memory accesses depending on the data or the round keys. Produces the same
+ * result as calling KalynaEncipher() for each block. The round keys
+ * themselves come from KalynaKeyExpand(), which does use table lookups
+ * indexed by key material. Select KALYNA_BACKEND_BITSLICED to use this
+ * implementation for single blocks and the modes of operation as well.
+ * Expect about 20 to 25 times the time per block of KalynaEncipherBlocks()
+ * with the table kernels.
+ *
+ * @param plaintext Plaintext of length `nblocks` * Nb words.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param ciphertext The result of enciphering, may be equal to `plaintext`.
+ * @param nblocks Number of blocks.
+ */
+void KalynaBitslicedEncipher(const uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext, size_t nblocks);
+
+/*!
+ * Decipher multiple blocks with the bitsliced constant-time implementation.
+ * See KalynaBitslicedEncipher().
+ *
+ * @param ciphertext Enciphered data of length `nblocks` * Nb words.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param plaintext The result of deciphering, may be equal to `ciphertext`.
+ * @param nblocks Number of blocks.
+ */
+void KalynaBitslicedDecipher(const uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext, size_t nblocks);
+
 #endif  /* KALYNA_H */
 
@@ -0,0 +1,494 @@
+/*
+
+Template of the variant specialized kernels for the Kalyna block cipher (DSTU 7624:2014)
+
+Included by kernels.c once per supported variant with KERNEL_NB, KERNEL_NK,
+KERNEL_NR (words in block, words in key, rounds) and KERNEL(name) (variant
+suffixed function name) defined. Every loop has a constant trip count, so the
+compiler unrolls the rounds and turns ShiftRows into fixed word indices.
+
+*/
+
+static inline void KERNEL(EncipherRound)(const uint64_t* s, uint64_t* t) {
+    int col, row;
+    uint64_t c;
+    KALYNA_UNROLL(8)
+    for (col = 0; col < KERNEL_NB; ++col) {
+        c = 0;
+        KALYNA_UNROLL(8)
+        for (row = 0; row < 8; ++row) {
+            c ^= ttables_enc[row][BYTE(s[(col + KERNEL_NB - SHIFT(row, KERNEL_NB)) % KERNEL_NB], row)];
+        }
+        t[col] = c;
+    }
+}
+
+static inline void KERNEL(DecipherRound)(const uint64_t* s, uint64_t* t) {
+    int col, row;
+    uint64_t c;
+    KALYNA_UNROLL(8)
+    for (col = 0; col < KERNEL_NB; ++col) {
+        c = 0;
+        KALYNA_UNROLL(8)
+        for (row = 0; row < 8; ++row) {
+            c ^= ttables_dec[row][BYTE(s[(col + SHIFT(row, KERNEL_NB)) % KERNEL_NB], row)];
+        }
+        t[col] = c;
+    }
+}
+
+/* InvSubBytes and InvShiftRows of the last deciphering round. */
+static inline void KERNEL(DecipherLastRound)(const uint64_t* s, uint64_t* t) {
+    int col, row;
+    uint64_t c;
+    KALYNA_UNROLL(8)
+    for (col = 0; col < KERNEL_NB; ++col) {
+        c = 0;
+        KALYNA_UNROLL(8)
+        for (row = 0; row < 8; ++row) {
+            c |= (uint64_t)sboxes_dec[row % 4][BYTE(s[(col + SHIFT(row, KERNEL_NB)) % KERNEL_NB], row)] << (row * 8);
+        }
+        t[col] = c;
+    }
+}
+
+static inline void KERNEL(InvMixColumns)(const uint64_t* s, uint64_t* t) {
+    int col, row;
+    uint64_t c;
+    KALYNA_UNROLL(8)
+    for (col = 0; col < KERNEL_NB; ++col) {
+        c = 0;
+        KALYNA_UNROLL(8)
+        for (row = 0; row < 8; ++row) {
+            c ^= ttables_dec[row][sboxes_enc[row % 4][BYTE(s[col], row)]];
+        }
+        t[col] = c;
+    }
+}
+
+/* Rotate the (2 * Nb + 3) bytes to the left, see RotateLeft(). */
+static inline void KERNEL(RotateLeft)(const uint64_t* s, uint64_t* t) {
+    int i;
+    const int q = (2 * KERNEL_NB + 3) / 8;
+    const int r = (2 * KERNEL_NB + 3) % 8 * 8;
+    KALYNA_UNROLL(8)
+    for (i = 0; i < KERNEL_NB; ++i) {
+        t[i] = (s[(i + q) % KERNEL_NB] >> r) | (s[(i + q + 1) % KERNEL_NB] << (64 - r));
+    }
+}
+
+
+static void KERNEL(Encipher)(const uint64_t* plaintext, const kalyna_schedule_t* schedule, uint64_t* ciphertext) {
+    int round, i;
+    uint64_t s[KERNEL_NB], t[KERNEL_NB];
+    const uint64_t* rk = schedule->round_keys;
+
+    for (i = 0; i < KERNEL_NB; ++i)
+        s[i] = plaintext[i] + RK(rk, 0)[i];
+    KALYNA_UNROLL(KERNEL_NR)
+    for (round = 1; round < KERNEL_NR; ++round) {
+        KERNEL(EncipherRound)(s, t);
+        for (i = 0; i < KERNEL_NB; ++i)
+            s[i] = t[i] ^ RK(rk, round)[i];
+    }
+    KERNEL(EncipherRound)(s, t);
+    for (i = 0; i < KERNEL_NB; ++i)
+        ciphertext[i] = t[i] + RK(rk, KERNEL_NR)[i];
+}
+
+static void KERNEL(Decipher)(const uint64_t* ciphertext, const kalyna_schedule_t* schedule, uint64_t* plaintext) {
+    int round, i;
+    uint64_t s[KERNEL_NB], t[KERNEL_NB];
+    const uint64_t* rk = schedule->round_keys;
+    const uint64_t* irk = schedule->inv_round_keys;
+
+    for (i = 0; i < KERNEL_NB; ++i)
+        s[i] = ciphertext[i] - RK(rk, KERNEL_NR)[i];
+    KERNEL(InvMixColumns)(s, t);
+    KALYNA_UNROLL(KERNEL_NR)
+    for (round = KERNEL_NR - 1; round > 0; --round) {
+        KERNEL(DecipherRound)(t, s);
+        for (i = 0; i < KERNEL_NB; ++i)
+            t[i] = s[i] ^ RK(irk, round)[i];
+    }
+    KERNEL(DecipherLastRound)(t, s);
+    for (i = 0; i < KERNEL_NB; ++i)
+        plaintext[i] = s[i] - RK(rk, 0)[i];
+}
+
+/* Multiple blocks, KERNEL_LANES at a time: the rounds of independent blocks
+ * are interleaved so their table lookups overlap. Every group is loaded
+ * before it is stored, so the input and output may be the same buffer. */
+static void KERNEL(EncipherBlocks)(const uint64_t* plaintext, const kalyna_schedule_t* schedule,
+                                   uint64_t* ciphertext, size_t nblocks) {
+    int round, lane, i;
+    size_t n;
+    uint64_t s[KERNEL_LANES][KERNEL_NB], t[KERNEL_LANES][KERNEL_NB];
+    const uint64_t* rk = schedule->round_keys;
+
+    for (n = 0; n + KERNEL_LANES <= nblocks; n += KERNEL_LANES) {
+        for (lane = 0; lane < KERNEL_LANES; ++lane) {
+            for (i = 0; i < KERNEL_NB; ++i)
+                s[lane][i] = plaintext[(n + lane) * KERNEL_NB + i] + RK(rk, 0)[i];
+        }
+        KALYNA_UNROLL(KERNEL_NR)
+        for (round = 1; round < KERNEL_NR; ++round) {
+            KALYNA_UNROLL(KERNEL_LANES)
+            for (lane = 0; lane < KERNEL_LANES; ++lane)
+                KERNEL(EncipherRound)(s[lane], t[lane]);
+            for (lane = 0; lane < KERNEL_LANES; ++lane) {
+                for (i = 0; i < KERNEL_NB; ++i)
+                    s[lane][i] = t[lane][i] ^ RK(rk, round)[i];
+            }
+        }
+        KALYNA_UNROLL(KERNEL_LANES)
+        for (lane = 0; lane < KERNEL_LANES; ++lane)
+            KERNEL(EncipherRound)(s[lane], t[lane]);
+        for (lane = 0; lane < KERNEL_LANES; ++lane) {
+            for (i = 0; i < KERNEL_NB; ++i)
+                ciphertext[(n + lane) * KERNEL_NB + i] = t[lane][i] + RK(rk, KERNEL_NR)[i];
+        }
+    }
+    for (; n < nblocks; ++n)
+        KERNEL(Encipher)(plaintext + n * KERNEL_NB, schedule, ciphertext + n * KERNEL_NB);
+}
+
+static void KERNEL(DecipherBlocks)(const uint64_t* ciphertext, const kalyna_schedule_t* schedule,
+                                   uint64_t* plaintext, size_t nblocks) {
+    int round, lane, i;
+    size_t n;
+    uint64_t s[KERNEL_LANES][KERNEL_NB], t[KERNEL_LANES][KERNEL_NB];
+    const uint64_t* rk = schedule->round_keys;
+    const uint64_t* irk = schedule->inv_round_keys;
+
+    for (n = 0; n + KERNEL_LANES <= nblocks; n += KERNEL_LANES) {
+        for (lane = 0; lane < KERNEL_LANES; ++lane) {
+            for (i = 0; i < KERNEL_NB; ++i)
+                s[lane][i] = ciphertext[(n + lane) * KERNEL_NB + i] - RK(rk, KERNEL_NR)[i];
+            KERNEL(InvMixColumns)(s[lane], t[lane]);
+        }
+        KALYNA_UNROLL(KERNEL_NR)
+        for (round = KERNEL_NR - 1; round > 0; --round) {
+            KALYNA_UNROLL(KERNEL_LANES)
+            for (lane = 0; lane < KERNEL_LANES; ++lane)
+                KERNEL(DecipherRound)(t[lane], s[lane]);
+            for (lane = 0; lane < KERNEL_LANES; ++lane) {
+                for (i = 0; i < KERNEL_NB; ++i)
+                    t[lane][i] = s[lane][i] ^ RK(irk, round)[i];
+            }
+        }
+        KALYNA_UNROLL(KERNEL_LANES)
+        for (lane = 0; lane < KERNEL_LANES; ++lane)
+            KERNEL(DecipherLastRound)(t[lane], s[lane]);
+        for (lane = 0; lane < KERNEL_LANES; ++lane) {
+            for (i = 0; i < KERNEL_NB; ++i)
+                plaintext[(n + lane) * KERNEL_NB + i] = s[lane][i] - RK(rk, 0)[i];
+        }
+    }
+    for (; n < nblocks; ++n)
+        KERNEL(Decipher)(ciphertext + n * KERNEL_NB, schedule, plaintext + n * KERNEL_NB);
+}
+
+/* Context entry points of the kernels above. */
+static void KERNEL(ContextEncipher)(const uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext) {
+    KERNEL(Encipher)(plaintext, &ctx->key_schedule, ciphertext);
+}
+
+static void KERNEL(ContextDecipher)(const uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext) {
+    KERNEL(Decipher)(ciphertext, &ctx->key_schedule, plaintext);
+}
+
+/* Kt, see KeyExpandKt(). */
+static inline void KERNEL(KeyExpandKt)(const uint64_t* key, uint64_t* kt) {
+    int i;
+    uint64_t s[KERNEL_NB], t[KERNEL_NB];
+    const uint64_t* k0 = key;
+    const uint64_t* k1 = key + (KERNEL_NK - KERNEL_NB);
+
+    for (i = 0; i < KERNEL_NB; ++i)
+        s[i] = k0[i];
+    s[0] += KERNEL_NB + KERNEL_NK + 1;
+    KERNEL(EncipherRound)(s, t);
+    for (i = 0; i < KERNEL_NB; ++i)
+        s[i] = t[i] ^ k1[i];
+    KERNEL(EncipherRound)(s, t);
+    for (i = 0; i < KERNEL_NB; ++i)
+        s[i] = t[i] + k0[i];
+    KERNEL(EncipherRound)(s, kt);
+}
+
+/* Even round key 2j on its own, see KeyExpand(). */
+static inline void KERNEL(EvenRoundKey)(const uint64_t* key, const uint64_t* kt, int j, uint64_t* rk) {
+    int i;
+    uint64_t s[KERNEL_NB], t[KERNEL_NB], kt_round[KERNEL_NB];
+    const int rotation = KERNEL_NK == KERNEL_NB ? j : j / 2;
+    const int half = KERNEL_NK == KERNEL_NB ? 0 : j % 2 * KERNEL_NB;
+
+    for (i = 0; i < KERNEL_NB; ++i) {
+        kt_round[i] = kt[i] + (0x0001000100010001ULL << j);
+        s[i] = key[(half + i + rotation) % KERNEL_NK] + kt_round[i];
+    }
+    KERNEL(EncipherRound)(s, t);
+    for (i = 0; i < KERNEL_NB; ++i)
+        s[i] = t[i] ^ kt_round[i];
+    KERNEL(EncipherRound)(s, t);
+    for (i = 0; i < KERNEL_NB; ++i)
+        rk[i] = t[i] + kt_round[i];
+}
+
+/* Odd and inverse cipher round keys from the even round keys. */
+static void KERNEL(KeyExpandDerived)(kalyna_t* ctx) {
+    int round;
+    uint64_t* rk = ctx->schedule;
+    uint64_t* irk = ctx->inv_schedule;
+
+    /* Odd round keys, see KeyExpandOdd(). */
+    for (round = 1; round < KERNEL_NR; round += 2)
+        KERNEL(RotateLeft)(RK(rk, round - 1), RK(rk, round));
+
+    /* Round keys of the equivalent inverse cipher, see KeyExpandInv(). */
+    for (round = 1; round < KERNEL_NR; ++round)
+        KERNEL(InvMixColumns)(RK(rk, round), RK(irk, round));
+    memcpy(RK(irk, 0), RK(rk, 0), KERNEL_NB * sizeof(uint64_t));
+    memcpy(RK(irk, KERNEL_NR), RK(rk, KERNEL_NR), KERNEL_NB * sizeof(uint64_t));
+}
+
+/* Even round keys, round key 2j written at `rk + stride * j * Nb`. */
+static inline void KERNEL(KeyExpandEvenKeys)(const uint64_t* key, uint64_t* rk, int stride) {
+    int j, i, rotation, half;
+    uint64_t kt[KERNEL_NB];
+    uint64_t es[KERNEL_NR / 2 + 1][KERNEL_NB], et[KERNEL_NR / 2 + 1][KERNEL_NB];
+    uint64_t kt_round[KERNEL_NR / 2 + 1][KERNEL_NB];
+
+    KERNEL(KeyExpandKt)(key, kt);
+
+    /* Even round keys, see KeyExpandEven(). Round key 2j only depends on
+     * Kt, tmv << j and the key rotated left by j words (double length keys:
+     * by j / 2 words, taking the upper half for odd j), so all of them are
+     * computed as independent lanes. */
+    for (j = 0; j <= KERNEL_NR / 2; ++j) {
+        rotation = KERNEL_NK == KERNEL_NB ? j : j / 2;
+        half = KERNEL_NK == KERNEL_NB ? 0 : j % 2 * KERNEL_NB;
+        for (i = 0; i < KERNEL_NB; ++i) {
+            kt_round[j][i] = kt[i] + (0x0001000100010001ULL << j);
+            es[j][i] = key[(half + i + rotation) % KERNEL_NK] + kt_round[j][i];
+        }
+    }
+    KALYNA_UNROLL(KERNEL_NR / 2 + 1)
+    for (j = 0; j <= KERNEL_NR / 2; ++j)
+        KERNEL(EncipherRound)(es[j], et[j]);
+    for (j = 0; j <= KERNEL_NR / 2; ++j) {
+        for (i = 0; i < KERNEL_NB; ++i)
+            es[j][i] = et[j][i] ^ kt_round[j][i];
+    }
+    KALYNA_UNROLL(KERNEL_NR / 2 + 1)
+    for (j = 0; j <= KERNEL_NR / 2; ++j)
+        KERNEL(EncipherRound)(es[j], et[j]);
+    for (j = 0; j <= KERNEL_NR / 2; ++j) {
+        for (i = 0; i < KERNEL_NB; ++i)
+            RK(rk, stride * j)[i] = et[j][i] + kt_round[j][i];
+    }
+}
+
+static void KERNEL(KeyExpand)(const uint64_t* key, kalyna_t* ctx) {
+    KERNEL(KeyExpandEvenKeys)(key, ctx->schedule, 2);
+    KERNEL(KeyExpandDerived)(ctx);
+}
+
+/* KeyExpand() already evaluates the rounds of a key as independent lanes,
+ * so keys are simply expanded one after another with the direct call. */
+static void KERNEL(KeyExpandBatch)(const uint64_t* keys, kalyna_t** ctxs, size_t count) {
+    size_t n;
+    for (n = 0; n < count; ++n)
+        KERNEL(KeyExpand)(keys + n * KERNEL_NK, ctxs[n]);
+}
+
+/* Encipher with round keys generated just before use: even keys from Kt,
+ * odd keys by rotating the even key before them. No schedule is stored. */
+static void KERNEL(EncipherOneShot)(const uint64_t* key, const uint64_t* plaintext, uint64_t* ciphertext,
+                                    size_t nblocks) {
+    int round, i;
+    size_t n;
+    uint64_t kt[KERNEL_NB], even[KERNEL_NB], odd[KERNEL_NB], t[KERNEL_NB];
+    const uint64_t* k;
+    uint64_t* c;
+
+    KERNEL(KeyExpandKt)(key, kt);
+    KERNEL(EvenRoundKey)(key, kt, 0, even);
+    for (n = 0; n < nblocks * KERNEL_NB; ++n)
+        ciphertext[n] = plaintext[n] + even[n % KERNEL_NB];
+    /* Blocks advance round by round, ciphertext holds their states. */
+    for (round = 1; round < KERNEL_NR; ++round) {
+        if (round % 2 == 1) {
+            KERNEL(RotateLeft)(even, odd);
+            k = odd;
+        } else {
+            KERNEL(EvenRoundKey)(key, kt, round / 2, even);
+            k = even;
+        }
+        for (n = 0; n < nblocks; ++n) {
+            c = ciphertext + n * KERNEL_NB;
+            KERNEL(EncipherRound)(c, t);
+            for (i = 0; i < KERNEL_NB; ++i)
+                c[i] = t[i] ^ k[i];
+        }
+    }
+    KERNEL(EvenRoundKey)(key, kt, KERNEL_NR / 2, even);
+    for (n = 0; n < nblocks; ++n) {
+        c = ciphertext + n * KERNEL_NB;
+        KERNEL(EncipherRound)(c, t);
+        for (i = 0; i < KERNEL_NB; ++i)
+            c[i] = t[i] + even[i];
+    }
+    SecureZero(kt, sizeof(kt));
+    SecureZero(even, sizeof(even));
+    SecureZero(odd, sizeof(odd));
+    SecureZero(t, sizeof(t));
+}
+
+/* Kernels of compact schedules: `round_keys` holds only the even round keys,
+ * key 2j at `round_keys + j * Nb`. Odd keys are rotated from the even key
+ * before them, inverse cipher keys pass through InvMixColumns each round. */
+static void KERNEL(CompactEncipher)(const uint64_t* plaintext, const kalyna_schedule_t* schedule,
+                                    uint64_t* ciphertext) {
+    int round, i;
+    uint64_t s[KERNEL_NB], t[KERNEL_NB], odd[KERNEL_NB];
+    const uint64_t* rk = schedule->round_keys;
+
+    for (i = 0; i < KERNEL_NB; ++i)
+        s[i] = plaintext[i] + RK(rk, 0)[i];
+    KALYNA_UNROLL(KERNEL_NR)
+    for (round = 1; round < KERNEL_NR; ++round) {
+        KERNEL(EncipherRound)(s, t);
+        if (round % 2 == 1) {
+            KERNEL(RotateLeft)(RK(rk, round / 2), odd);
+            for (i = 0; i < KERNEL_NB; ++i)
+                s[i] = t[i] ^ odd[i];
+        } else {
+            for (i = 0; i < KERNEL_NB; ++i)
+                s[i] = t[i] ^ RK(rk, round / 2)[i];
+        }
+    }
+    KERNEL(EncipherRound)(s, t);
+    for (i = 0; i < KERNEL_NB; ++i)
+        ciphertext[i] = t[i] + RK(rk, KERNEL_NR / 2)[i];
+}
+
+static void KERNEL(CompactDecipher)(const uint64_t* ciphertext, const kalyna_schedule_t* schedule,
+                                    uint64_t* plaintext) {
+    int round, i;
+    uint64_t s[KERNEL_NB], t[KERNEL_NB], odd[KERNEL_NB], inv[KERNEL_NB];
+    const uint64_t* rk = schedule->round_keys;
+
+    for (i = 0; i < KERNEL_NB; ++i)
+        s[i] = ciphertext[i] - RK(rk, KERNEL_NR / 2)[i];
+    KERNEL(InvMixColumns)(s, t);
+    /* Odd round 2j + 1 and even round 2j share even key 2j. */
+    for (round = KERNEL_NR - 1; round > 0; round -= 2) {
+        KERNEL(DecipherRound)(t, s);
+        KERNEL(RotateLeft)(RK(rk, round / 2), odd);
+        KERNEL(InvMixColumns)(odd, inv);
+        for (i = 0; i < KERNEL_NB; ++i)
+            t[i] = s[i] ^ inv[i];
+        if (round == 1)
+            break;
+        KERNEL(DecipherRound)(t, s);
+        KERNEL(InvMixColumns)(RK(rk, round / 2), inv);
+        for (i = 0; i < KERNEL_NB; ++i)
+            t[i] = s[i] ^ inv[i];
+    }
+    KERNEL(DecipherLastRound)(t, s);
+    for (i = 0; i < KERNEL_NB; ++i)
+        plaintext[i] = s[i] - RK(rk, 0)[i];
+}
+
+/* CBC enciphering of independent messages, KERNEL_LANES at a time. Every
+ * lane advances its message by one block per step with the message's own
+ * round keys and takes the next message once its own ends. */
+/* Encipher the next block of the messages in the first `n` lanes. */
+static inline void KERNEL(CbcStep)(const kalyna_cbc_stream_t** lanes, size_t* block, const uint64_t** rk,
+                                   const uint64_t** previous, uint64_t s[][KERNEL_NB], uint64_t t[][KERNEL_NB],
+                                   int n) {
+    int round, lane, i;
+    const uint64_t* p;
+    uint64_t* c;
+
+    for (lane = 0; lane < n; ++lane) {
+        p = lanes[lane]->plaintext + block[lane] * KERNEL_NB;
+        for (i = 0; i < KERNEL_NB; ++i)
+            s[lane][i] = (p[i] ^ previous[lane][i]) + RK(rk[lane], 0)[i];
+    }
+    KALYNA_UNROLL(KERNEL_NR)
+    for (round = 1; round < KERNEL_NR; ++round) {
+        KALYNA_UNROLL(KERNEL_LANES)
+        for (lane = 0; lane < n; ++lane)
+            KERNEL(EncipherRound)(s[lane], t[lane]);
+        for (lane = 0; lane < n; ++lane) {
+            for (i = 0; i < KERNEL_NB; ++i)
+                s[lane][i] = t[lane][i] ^ RK(rk[lane], round)[i];
+        }
+    }
+    KALYNA_UNROLL(KERNEL_LANES)
+    for (lane = 0; lane < n; ++lane)
+        KERNEL(EncipherRound)(s[lane], t[lane]);
+    for (lane = 0; lane < n; ++lane) {
+        c = lanes[lane]->ciphertext + block[lane] * KERNEL_NB;
+        for (i = 0; i < KERNEL_NB; ++i)
+            c[i] = t[lane][i] + RK(rk[lane], KERNEL_NR)[i];
+        previous[lane] = c;
+        ++block[lane];
+    }
+}
+
+static void KERNEL(CbcEncipherStreams)(const kalyna_cbc_stream_t* streams, size_t count) {
+    int lane, active, width;
+    size_t next = 0;
+    size_t block[KERNEL_LANES];
+    const kalyna_cbc_stream_t* lanes[KERNEL_LANES];
+    const uint64_t* rk[KERNEL_LANES];
+    const uint64_t* previous[KERNEL_LANES];
+    uint64_t s[KERNEL_LANES][KERNEL_NB], t[KERNEL_LANES][KERNEL_NB];
+
+    for (lane = 0; lane < KERNEL_LANES; ++lane)
+        lanes[lane] = NULL;
+    for (;;) {
+        active = 0;
+        for (lane = 0; lane < KERNEL_LANES; ++lane) {
+            if (lanes[lane] != NULL && block[lane] == lanes[lane]->nblocks)
+                lanes[lane] = NULL;
+            for (; lanes[lane] == NULL && next < count; ++next) {
+                if (streams[next].nblocks == 0)
+                    continue;
+                lanes[lane] = &streams[next];
+                block[lane] = 0;
+                rk[lane] = streams[next].ctx->key_schedule.round_keys;
+                previous[lane] = streams[next].iv;
+            }
+            active += lanes[lane] != NULL;
+        }
+        if (active < KERNEL_LANES)
+            break;
+        KERNEL(CbcStep)(lanes, block, rk, previous, s, t, KERNEL_LANES);
+    }
+
+    /* Out of messages: keep the unfinished ones at the front and step
+     * them together, fewer at a time as they end. */
+    for (;;) {
+        for (lane = 0, width = 0; lane < KERNEL_LANES; ++lane) {
+            if (lanes[lane] == NULL || block[lane] == lanes[lane]->nblocks)
+                continue;
+            lanes[width] = lanes[lane];
+            block[width] = block[lane];
+            rk[width] = rk[lane];
+            previous[width] = previous[lane];
+            ++width;
+        }
+        if (width == 0)
+            break;
+        for (lane = width; lane < KERNEL_LANES; ++lane)
+            lanes[lane] = NULL;
+        KERNEL(CbcStep)(lanes, block, rk, previous, s, t, width);
+    }
+    SecureZero(s, sizeof(s));
+    SecureZero(t, sizeof(t));
+}
@@ -0,0 +1,341 @@
+/*
+
+Variant specialized kernels for the Kalyna block cipher (DSTU 7624:2014)
+
+Each supported block and key length combination gets its own enciphering,
+deciphering and key expansion kernel generated from kernel_template.h.
+
+*/
+
+#include <pthread.h>
+
+#include "transformations.h"
+#include "tables.h"
+
+
+#if defined(__clang__)
+#define KALYNA_PRAGMA(x) _Pragma(#x)
+#define KALYNA_UNROLL(n) KALYNA_PRAGMA(unroll n)
+#elif defined(__GNUC__)
+#define KALYNA_PRAGMA(x) _Pragma(#x)
+#define KALYNA_UNROLL(n) KALYNA_PRAGMA(GCC unroll n)
+#else
+#define KALYNA_UNROLL(n)
+#endif
+
+/* Byte of the state matrix `row` from state column (word) `word`. */
+#define BYTE(word, row) (((word) >> ((row) * 8)) & 0xFF)
+
+/* Number of columns the state matrix `row` is shifted by ShiftRows. */
+#define SHIFT(row, nb) ((row) * (nb) / 8)
+
+/* Round key `round` of a contiguous schedule. */
+#define RK(schedule, round) ((schedule) + (round) * KERNEL_NB)
+
+/* Blocks interleaved by the multi-block kernels: enough to keep 8 state
+ * words in flight. Kalyna-512 blocks already are 8 independent columns. */
+#define KERNEL_LANES (8 / KERNEL_NB)
+
+#define KERNEL_CAT2(name, suffix) name ## suffix
+#define KERNEL_CAT(name, suffix) KERNEL_CAT2(name, suffix)
+#define KERNEL(name) KERNEL_CAT(name, KERNEL_SUFFIX)
+
+
+#define KERNEL_NB kNB_128
+#define KERNEL_NK kNK_128
+#define KERNEL_NR kNR_128
+#define KERNEL_SUFFIX 128_128
+#include "kernel_template.h"
+#undef KERNEL_NB
+#undef KERNEL_NK
+#undef KERNEL_NR
+#undef KERNEL_SUFFIX
+
+#define KERNEL_NB kNB_128
+#define KERNEL_NK kNK_256
+#define KERNEL_NR kNR_256
+#define KERNEL_SUFFIX 128_256
+#include "kernel_template.h"
+#undef KERNEL_NB
+#undef KERNEL_NK
+#undef KERNEL_NR
+#undef KERNEL_SUFFIX
+
+#define KERNEL_NB kNB_256
+#define KERNEL_NK kNK_256
+#define KERNEL_NR kNR_256
+#define KERNEL_SUFFIX 256_256
+#include "kernel_template.h"
+#undef KERNEL_NB
+#undef KERNEL_NK
+#undef KERNEL_NR
+#undef KERNEL_SUFFIX
+
+#define KERNEL_NB kNB_256
+#define KERNEL_NK kNK_512
+#define KERNEL_NR kNR_512
+#define KERNEL_SUFFIX 256_512
+#include "kernel_template.h"
+#undef KERNEL_NB
+#undef KERNEL_NK
+#undef KERNEL_NR
+#undef KERNEL_SUFFIX
+
+#define KERNEL_NB kNB_512
+#define KERNEL_NK kNK_512
+#define KERNEL_NR kNR_512
+#define KERNEL_SUFFIX 512_512
+#include "kernel_template.h"
+#undef KERNEL_NB
+#undef KERNEL_NK
+#undef KERNEL_NR
+#undef KERNEL_SUFFIX
+
+
+static const char* backend_names[] = {"auto", "generic", "tables", "avx2", "gfni", "bitsliced"};
+
+
+unsigned KalynaCpuFeatures() {
+    unsigned features = 0;
+#if defined(__x86_64__) || defined(__i386__)
+    /* Reads the cpuid (and XGETBV) results cached by the compiler runtime. */
+    if (__builtin_cpu_supports("ssse3"))
+        features |= KALYNA_CPU_SSSE3;
+    if (__builtin_cpu_supports("avx2"))
+        features |= KALYNA_CPU_AVX2;
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+        features |= KALYNA_CPU_AVX512;
+    if (__builtin_cpu_supports("gfni"))
+        features |= KALYNA_CPU_GFNI;
+#endif
+    return features;
+}
+
+int KalynaBackendSupported(kalyna_backend_t backend) {
+    unsigned features = KalynaCpuFeatures();
+    switch (backend) {
+        case KALYNA_BACKEND_AUTO:
+        case KALYNA_BACKEND_GENERIC:
+        case KALYNA_BACKEND_TABLES:
+        case KALYNA_BACKEND_BITSLICED:
+            return TRUE;
+        case KALYNA_BACKEND_AVX2:
+            return (features & KALYNA_CPU_AVX2) != 0;
+        case KALYNA_BACKEND_GFNI:
+            return (features & KALYNA_CPU_AVX2) && (features & KALYNA_CPU_GFNI);
+    }
+    return FALSE;
+}
+
+const char* KalynaBackendName(kalyna_backend_t backend) {
+    if ((size_t)backend >= sizeof(backend_names) / sizeof(backend_names[0]))
+        return "unknown";
+    return backend_names[backend];
+}
+
+static kalyna_backend_t environment_backend = KALYNA_BACKEND_AUTO;
+static pthread_once_t environment_once = PTHREAD_ONCE_INIT;
+
+static void ReadEnvironmentBackend(void) {
+    size_t i;
+    const char* name = getenv("KALYNA_BACKEND");
+    if (name == NULL)
+        return;
+    for (i = 0; i < sizeof(backend_names) / sizeof(backend_names[0]); ++i) {
+        if (strcmp(name, backend_names[i]) == 0)
+            environment_backend = (kalyna_backend_t)i;
+    }
+}
+
+kalyna_backend_t BackendFromEnvironment() {
+    /* KalynaInitBuffer() runs on the pool, cache and store paths, so the
+     * environment is only looked up the first time. */
+    pthread_once(&environment_once, ReadEnvironmentBackend);
+    return environment_backend;
+}
+
+int KalynaSetBackend(kalyna_t* ctx, kalyna_backend_t backend) {
+    if (!KalynaBackendSupported(backend))
+        return -1;
+    /* The AVX2 and GFNI kernels are bound by S-Box gathers and measure
+     * slower than the table kernels for every variant (make benchmark with
+     * KALYNA_BACKEND set), so they are only used when requested. */
+    if (backend == KALYNA_BACKEND_AUTO)
+        backend = KALYNA_BACKEND_TABLES;
+    SelectKernels(ctx, backend);
+    return 0;
+}
+
+void ScheduleEncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule,
+                            uint64_t* ciphertext, size_t nblocks) {
+    size_t i;
+    for (i = 0; i < nblocks; ++i) {
+        schedule->encipher(plaintext + i * schedule->nb, schedule, ciphertext + i * schedule->nb);
+    }
+}
+
+void ScheduleDecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule,
+                            uint64_t* plaintext, size_t nblocks) {
+    size_t i;
+    for (i = 0; i < nblocks; ++i) {
+        schedule->decipher(ciphertext + i * schedule->nb, schedule, plaintext + i * schedule->nb);
+    }
+}
+
+/* Context entry points of the schedule's multi-block kernels. */
+static void ContextEncipherBlocks(const uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext, size_t nblocks) {
+    ctx->key_schedule.encipher_blocks(plaintext, &ctx->key_schedule, ciphertext, nblocks);
+}
+
+static void ContextDecipherBlocks(const uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext, size_t nblocks) {
+    ctx->key_schedule.decipher_blocks(ciphertext, &ctx->key_schedule, plaintext, nblocks);
+}
+
+/* Context entry points of the schedule's single block kernels. */
+static void ContextScheduleEncipher(const uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext) {
+    ctx->key_schedule.encipher(plaintext, &ctx->key_schedule, ciphertext);
+}
+
+static void ContextScheduleDecipher(const uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext) {
+    ctx->key_schedule.decipher(ciphertext, &ctx->key_schedule, plaintext);
+}
+
+int KalynaEncipherOneShot(size_t block_size, size_t key_size, const uint64_t* key,
+                          const uint64_t* plaintext, uint64_t* ciphertext, size_t nblocks) {
+    if (block_size == kBLOCK_128 && key_size == kKEY_128)
+        EncipherOneShot128_128(key, plaintext, ciphertext, nblocks);
+    else if (block_size == kBLOCK_128 && key_size == kKEY_256)
+        EncipherOneShot128_256(key, plaintext, ciphertext, nblocks);
+    else if (block_size == kBLOCK_256 && key_size == kKEY_256)
+        EncipherOneShot256_256(key, plaintext, ciphertext, nblocks);
+    else if (block_size == kBLOCK_256 && key_size == kKEY_512)
+        EncipherOneShot256_512(key, plaintext, ciphertext, nblocks);
+    else if (block_size == kBLOCK_512 && key_size == kKEY_512)
+        EncipherOneShot512_512(key, plaintext, ciphertext, nblocks);
+    else
+        return -1;
+    return 0;
+}
+
+int CbcEncipherStreams(const kalyna_cbc_stream_t* streams, size_t count) {
+    size_t nb = streams[0].ctx->nb, nk = streams[0].ctx->nk;
+    if (nb == kNB_128 && nk == kNK_128)
+        CbcEncipherStreams128_128(streams, count);
+    else if (nb == kNB_128 && nk == kNK_256)
+        CbcEncipherStreams128_256(streams, count);
+    else if (nb == kNB_256 && nk == kNK_256)
+        CbcEncipherStreams256_256(streams, count);
+    else if (nb == kNB_256 && nk == kNK_512)
+        CbcEncipherStreams256_512(streams, count);
+    else if (nb == kNB_512 && nk == kNK_512)
+        CbcEncipherStreams512_512(streams, count);
+    else
+        return -1;
+    return 0;
+}
+
+#define SELECT_SCHEDULE_VARIANT(schedule, suffix) \
+    do { \
+        (schedule)->encipher = KERNEL_CAT(Encipher, suffix); \
+        (schedule)->decipher = KERNEL_CAT(Decipher, suffix); \
+        (schedule)->encipher_blocks = KERNEL_CAT(EncipherBlocks, suffix); \
+        (schedule)->decipher_blocks = KERNEL_CAT(DecipherBlocks, suffix); \
+    } while (0)
+
+int SelectScheduleKernels(kalyna_schedule_t* schedule) {
+    if (schedule->nb == kNB_128 && schedule->nk == kNK_128 && schedule->nr == kNR_128)
+        SELECT_SCHEDULE_VARIANT(schedule, 128_128);
+    else if (schedule->nb == kNB_128 && schedule->nk == kNK_256 && schedule->nr == kNR_256)
+        SELECT_SCHEDULE_VARIANT(schedule, 128_256);
+    else if (schedule->nb == kNB_256 && schedule->nk == kNK_256 && schedule->nr == kNR_256)
+        SELECT_SCHEDULE_VARIANT(schedule, 256_256);
+    else if (schedule->nb == kNB_256 && schedule->nk == kNK_512 && schedule->nr == kNR_512)
+        SELECT_SCHEDULE_VARIANT(schedule, 256_512);
+    else if (schedule->nb == kNB_512 && schedule->nk == kNK_512 && schedule->nr == kNR_512)
+        SELECT_SCHEDULE_VARIANT(schedule, 512_512);
+    else
+        return -1;
+    return 0;
+}
+
+#define SELECT_COMPACT_VARIANT(schedule, even_keys, key, suffix) \
+    do { \
+        KERNEL_CAT(KeyExpandEvenKeys, suffix)(key, even_keys, 1); \
+        (schedule)->encipher = KERNEL_CAT(CompactEncipher, suffix); \
+        (schedule)->decipher = KERNEL_CAT(CompactDecipher, suffix); \
+    } while (0)
+
+void CompactKeyExpand(const uint64_t* key, kalyna_schedule_t* schedule, uint64_t* even_keys) {
+    if (schedule->nb == kNB_128 && schedule->nk == kNK_128)
+        SELECT_COMPACT_VARIANT(schedule, even_keys, key, 128_128);
+    else if (schedule->nb == kNB_128 && schedule->nk == kNK_256)
+        SELECT_COMPACT_VARIANT(schedule, even_keys, key, 128_256);
+    else if (schedule->nb == kNB_256 && schedule->nk == kNK_256)
+        SELECT_COMPACT_VARIANT(schedule, even_keys, key, 256_256);
+    else if (schedule->nb == kNB_256 && schedule->nk == kNK_512)
+        SELECT_COMPACT_VARIANT(schedule, even_keys, key, 256_512);
+    else if (schedule->nb == kNB_512 && schedule->nk == kNK_512)
+        SELECT_COMPACT_VARIANT(schedule, even_keys, key, 512_512);
+    schedule->round_keys = even_keys;
+    schedule->inv_round_keys = NULL;
+    schedule->encipher_blocks = ScheduleEncipherBlocks;
+    schedule->decipher_blocks = ScheduleDecipherBlocks;
+}
+
+#define SELECT_VARIANT(ctx, suffix) \
+    do { \
+        (ctx)->encipher = KERNEL_CAT(ContextEncipher, suffix); \
+        (ctx)->decipher = KERNEL_CAT(ContextDecipher, suffix); \
+        (ctx)->key_expand = KERNEL_CAT(KeyExpand, suffix); \
+        (ctx)->key_expand_batch = KERNEL_CAT(KeyExpandBatch, suffix); \
+        (ctx)->key_schedule.encipher = KERNEL_CAT(Encipher, suffix); \
+        (ctx)->key_schedule.decipher = KERNEL_CAT(Decipher, suffix); \
+        (ctx)->key_schedule.encipher_blocks = KERNEL_CAT(EncipherBlocks, suffix); \
+        (ctx)->key_schedule.decipher_blocks = KERNEL_CAT(DecipherBlocks, suffix); \
+    } while (0)
+
+void SelectKernels(kalyna_t* ctx, kalyna_backend_t backend) {
+    ctx->backend = backend;
+    /* Schedule kernels are the stateless table kernels for every backend;
+     * KalynaInit() only accepts the five specialized variants. */
+    if (ctx->nb == kNB_128 && ctx->nk == kNK_128)
+        SELECT_VARIANT(ctx, 128_128);
+    else if (ctx->nb == kNB_128 && ctx->nk == kNK_256)
+        SELECT_VARIANT(ctx, 128_256);
+    else if (ctx->nb == kNB_256 && ctx->nk == kNK_256)
+        SELECT_VARIANT(ctx, 256_256);
+    else if (ctx->nb == kNB_256 && ctx->nk == kNK_512)
+        SELECT_VARIANT(ctx, 256_512);
+    else if (ctx->nb == kNB_512 && ctx->nk == kNK_512)
+        SELECT_VARIANT(ctx, 512_512);
+
+    if (backend == KALYNA_BACKEND_GFNI) {
+        ctx->key_schedule.encipher_blocks = GfniEncipherBlocks;
+        ctx->key_schedule.decipher_blocks = GfniDecipherBlocks;
+    } else if (backend == KALYNA_BACKEND_AVX2) {
+        ctx->key_schedule.encipher_blocks = Avx2EncipherBlocks;
+        ctx->key_schedule.decipher_blocks = Avx2DecipherBlocks;
+    }
+    ctx->encipher_blocks = ContextEncipherBlocks;
+    ctx->decipher_blocks = ContextDecipherBlocks;
+
+    if (backend == KALYNA_BACKEND_BITSLICED) {
+        /* Every block, including the single ones of CBC and of the CTR
+         * initial counter, goes through the constant-time kernels. */
+        ctx->key_schedule.encipher = BitslicedEncipher;
+        ctx->key_schedule.decipher = BitslicedDecipher;
+        ctx->key_schedule.encipher_blocks = BitslicedEncipherBlocks;
+        ctx->key_schedule.decipher_blocks = BitslicedDecipherBlocks;
+        ctx->encipher = ContextScheduleEncipher;
+        ctx->decipher = ContextScheduleDecipher;
+    }
+
+    if (backend == KALYNA_BACKEND_GENERIC) {
+        ctx->encipher = GenericEncipher;
+        ctx->decipher = GenericDecipher;
+        ctx->key_expand = GenericKeyExpand;
+        ctx->key_expand_batch = GenericKeyExpandBatch;
+        ctx->encipher_blocks = GenericEncipherBlocks;
+        ctx->decipher_blocks = GenericDecipherBlocks;
+    }
+}
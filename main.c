@@ -8,11 +8,39 @@ Authors: Ruslan Kiianchuk, Ruslan Mordvinov, Roman Oliynykov
 
 #include <stdio.h>
 #include <memory.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
 
 #include "kalyna.h"
 #include "transformations.h"
+#include "tables.h"
 
 void print (int data_size, uint64_t data []);
+void check_kernels (size_t block_size, size_t key_size);
+void check_bitsliced (size_t block_size, size_t key_size);
+void check_blocks (size_t block_size, size_t key_size);
+void check_gfni_matrices (void);
+void check_backends (size_t block_size, size_t key_size);
+void check_buffer (size_t block_size, size_t key_size);
+void check_schedule (size_t block_size, size_t key_size);
+void check_key_batch (size_t block_size, size_t key_size);
+void check_one_shot (size_t block_size, size_t key_size);
+void check_compact_schedule (size_t block_size, size_t key_size);
+void check_cache (void);
+void check_registry (void);
+void check_snapshot (void);
+void check_store (void);
+void check_pool (size_t block_size, size_t key_size);
+void check_ctr (size_t block_size, size_t key_size);
+void check_ctr_vector (void);
+void check_ctr_seek (size_t block_size, size_t key_size);
+void check_cbc (size_t block_size, size_t key_size);
+void check_cbc_vector (void);
+void check_cbc_streams (size_t block_size, size_t key_size);
+
+static int failures = 0;
 
 int main(int argc, char** argv) {
    
@@ -105,7 +133,7 @@ int main(int argc, char** argv) {
     printf("Ciphertext:\n");
     print(ctx22_e->nb, ct22_e);
 
-	if (memcmp(ct22_e, expect22_e, sizeof(ct22_e)) != 0) printf("Failed enciphering\n");
+	if (memcmp(ct22_e, expect22_e, sizeof(ct22_e)) != 0) { printf("Failed enciphering\n"); ++failures; }
 	else printf("Success enciphering\n\n");
 
 	KalynaDelete(ctx22_e);
@@ -127,7 +155,7 @@ int main(int argc, char** argv) {
     printf("Plaintext:\n");
     print(ctx22_d->nb, pt22_d);
 
-	if (memcmp(pt22_d, expect22_d, sizeof(pt22_d)) != 0) printf("Failed deciphering\n");
+	if (memcmp(pt22_d, expect22_d, sizeof(pt22_d)) != 0) { printf("Failed deciphering\n"); ++failures; }
 	else printf("Success deciphering\n\n");
 
 	KalynaDelete(ctx22_d);
@@ -149,7 +177,7 @@ int main(int argc, char** argv) {
     printf("Ciphertext:\n");
     print(ctx24_e->nb, ct24_e);
 
-	if (memcmp(ct24_e, expect24_e, sizeof(ct24_e)) != 0) printf("Failed enciphering\n");
+	if (memcmp(ct24_e, expect24_e, sizeof(ct24_e)) != 0) { printf("Failed enciphering\n"); ++failures; }
 	else printf("Success enciphering\n\n");
 
 	KalynaDelete(ctx24_e);
@@ -171,7 +199,7 @@ int main(int argc, char** argv) {
     printf("Plaintext:\n");
     print(ctx24_d->nb, pt24_d);
 
-	if (memcmp(pt24_d, expect24_d, sizeof(pt24_d)) != 0) printf("Failed deciphering\n");
+	if (memcmp(pt24_d, expect24_d, sizeof(pt24_d)) != 0) { printf("Failed deciphering\n"); ++failures; }
 	else printf("Success deciphering\n\n");
 
 	KalynaDelete(ctx24_d);
@@ -193,7 +221,7 @@ int main(int argc, char** argv) {
     printf("Ciphertext:\n");
     print(ctx44_e->nb, ct44_e);
 
-	if (memcmp(ct44_e, expect44_e, sizeof(ct44_e)) != 0) printf("Failed enciphering\n");
+	if (memcmp(ct44_e, expect44_e, sizeof(ct44_e)) != 0) { printf("Failed enciphering\n"); ++failures; }
 	else printf("Success enciphering\n\n");
 
 	KalynaDelete(ctx44_e);
@@ -215,7 +243,7 @@ int main(int argc, char** argv) {
     printf("Plaintext:\n");
     print(ctx44_d->nb, pt44_d);
 
-	if (memcmp(pt44_d, expect44_d, sizeof(pt44_d)) != 0) printf("Failed deciphering\n");
+	if (memcmp(pt44_d, expect44_d, sizeof(pt44_d)) != 0) { printf("Failed deciphering\n"); ++failures; }
 	else printf("Success deciphering\n\n");
 
 	KalynaDelete(ctx44_d);
@@ -237,7 +265,7 @@ int main(int argc, char** argv) {
     printf("Ciphertext:\n");
     print(ctx48_e->nb, ct48_e);
 
-	if (memcmp(ct48_e, expect48_e, sizeof(ct48_e)) != 0) printf("Failed enciphering\n");
+	if (memcmp(ct48_e, expect48_e, sizeof(ct48_e)) != 0) { printf("Failed enciphering\n"); ++failures; }
 	else printf("Success enciphering\n\n");
 
 	KalynaDelete(ctx48_e);
@@ -259,7 +287,7 @@ int main(int argc, char** argv) {
     printf("Plaintext:\n");
     print(ctx48_d->nb, pt48_d);
 
-	if (memcmp(pt48_d, expect48_d, sizeof(pt48_d)) != 0) printf("Failed deciphering\n");
+	if (memcmp(pt48_d, expect48_d, sizeof(pt48_d)) != 0) { printf("Failed deciphering\n"); ++failures; }
 	else printf("Success deciphering\n\n");
 
 	KalynaDelete(ctx48_d);
@@ -281,7 +309,7 @@ int main(int argc, char** argv) {
     printf("Ciphertext:\n");
     print(ctx88_e->nb, ct88_e);
 
-	if (memcmp(ct88_e, expect88_e, sizeof(ct88_e)) != 0) printf("Failed enciphering\n");
+	if (memcmp(ct88_e, expect88_e, sizeof(ct88_e)) != 0) { printf("Failed enciphering\n"); ++failures; }
 	else printf("Success enciphering\n\n");
 
 	KalynaDelete(ctx88_e);
@@ -303,12 +331,207 @@ int main(int argc, char** argv) {
     printf("Plaintext:\n");
     print(ctx88_d->nb, pt88_d);
 
-	if (memcmp(pt88_d, expect88_d, sizeof(pt88_d)) != 0) printf("Failed deciphering\n");
+	if (memcmp(pt88_d, expect88_d, sizeof(pt88_d)) != 0) { printf("Failed deciphering\n"); ++failures; }
 	else printf("Success deciphering\n\n");
 
 	KalynaDelete(ctx88_d);
 
-    return 0;
+	// specialized kernels against generic routines
+	printf("\n=============\n");
+	printf("Kernels\n\n");
+	check_kernels(128, 128);
+	check_kernels(128, 256);
+	check_kernels(256, 256);
+	check_kernels(256, 512);
+	check_kernels(512, 512);
+
+	// bitsliced implementation against specialized kernels
+	printf("\n=============\n");
+	printf("Bitsliced\n\n");
+	check_bitsliced(128, 128);
+	check_bitsliced(128, 256);
+	check_bitsliced(256, 256);
+	check_bitsliced(256, 512);
+	check_bitsliced(512, 512);
+
+	// multi-block (AVX2 when supported) against single block kernels
+	printf("\n=============\n");
+	printf("Blocks (AVX2 %s, GFNI %s)\n\n",
+		KalynaBackendSupported(KALYNA_BACKEND_AVX2) ? "enabled" : "not supported",
+		KalynaBackendSupported(KALYNA_BACKEND_GFNI) ? "enabled" : "not supported");
+	check_blocks(128, 128);
+	check_blocks(128, 256);
+	check_blocks(256, 256);
+	check_blocks(256, 512);
+	check_blocks(512, 512);
+
+	// every supported backend against the generic routines
+	printf("\n=============\n");
+	printf("Backends\n\n");
+	check_backends(128, 128);
+	check_backends(128, 256);
+	check_backends(256, 256);
+	check_backends(256, 512);
+	check_backends(512, 512);
+
+	// contexts in caller provided storage
+	printf("\n=============\n");
+	printf("Caller storage\n\n");
+	check_buffer(128, 128);
+	check_buffer(128, 256);
+	check_buffer(256, 256);
+	check_buffer(256, 512);
+	check_buffer(512, 512);
+
+	// batched key expansion against one key at a time
+	printf("\n=============\n");
+	printf("Batched key expansion\n\n");
+	check_key_batch(128, 128);
+	check_key_batch(128, 256);
+	check_key_batch(256, 256);
+	check_key_batch(256, 512);
+	check_key_batch(512, 512);
+
+	// one read-only key schedule shared by several threads
+	printf("\n=============\n");
+	printf("Shared schedule\n\n");
+	check_schedule(128, 128);
+	check_schedule(128, 256);
+	check_schedule(256, 256);
+	check_schedule(256, 512);
+	check_schedule(512, 512);
+
+	// single-use keys, round keys generated on the fly
+	printf("\n=============\n");
+	printf("One-shot encipher\n\n");
+	check_one_shot(128, 128);
+	check_one_shot(128, 256);
+	check_one_shot(256, 256);
+	check_one_shot(256, 512);
+	check_one_shot(512, 512);
+
+	// schedule storing only the even round keys
+	printf("\n=============\n");
+	printf("Compact schedule\n\n");
+	check_compact_schedule(128, 128);
+	check_compact_schedule(128, 256);
+	check_compact_schedule(256, 256);
+	check_compact_schedule(256, 512);
+	check_compact_schedule(512, 512);
+
+	// schedules shared through the cache by several threads
+	printf("\n=============\n");
+	printf("Schedule cache\n\n");
+	check_cache();
+
+	// key rotation while readers encipher
+	printf("\n=============\n");
+	printf("Key registry\n\n");
+	check_registry();
+
+	// schedules written to and used from a snapshot
+	printf("\n=============\n");
+	printf("Snapshot\n\n");
+	check_snapshot();
+
+	// schedules expanded once, shared with another process
+	printf("\n=============\n");
+	printf("Shared store\n\n");
+	check_store();
+
+	// contexts from a pool of slabs
+	printf("\n=============\n");
+	printf("Context pool\n\n");
+	check_pool(128, 128);
+	check_pool(128, 256);
+	check_pool(256, 256);
+	check_pool(256, 512);
+	check_pool(512, 512);
+
+	// counter (gamming) mode
+	printf("\n=============\n");
+	printf("CTR mode\n\n");
+	check_ctr(128, 128);
+	check_ctr(128, 256);
+	check_ctr(256, 256);
+	check_ctr(256, 512);
+	check_ctr(512, 512);
+	check_ctr_vector();
+	check_ctr_seek(128, 128);
+	check_ctr_seek(128, 256);
+	check_ctr_seek(256, 256);
+	check_ctr_seek(256, 512);
+	check_ctr_seek(512, 512);
+
+	// cipher block chaining mode
+	printf("\n=============\n");
+	printf("CBC mode\n\n");
+	check_cbc(128, 128);
+	check_cbc(128, 256);
+	check_cbc(256, 256);
+	check_cbc(256, 512);
+	check_cbc(512, 512);
+	check_cbc_vector();
+	check_cbc_streams(128, 128);
+	check_cbc_streams(128, 256);
+	check_cbc_streams(256, 256);
+	check_cbc_streams(256, 512);
+	check_cbc_streams(512, 512);
+
+	// GFNI affine matrices, emulated in software
+	printf("\n=============\n");
+	printf("GFNI matrices\n\n");
+	check_gfni_matrices();
+
+    return failures != 0;
+}
+
+
+/* Pseudo-random test data, deterministic across runs. */
+static uint64_t next_word (uint64_t * seed)
+{
+	*seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	return *seed ^ (*seed >> 29);
+}
+
+void check_kernels (size_t block_size, size_t key_size)
+{
+	int i, r, ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8], pt[8], ct[8], ct_generic[8], dt[8];
+	kalyna_t * ctx = KalynaInit(block_size, key_size);
+	kalyna_t * generic = KalynaInit(block_size, key_size);
+
+	for (i = 0; i < 8; i ++) key[i] = next_word(&seed);
+	KalynaKeyExpand(key, ctx);
+	GenericKeyExpand(key, generic);
+	/* One cache line aligned schedule in round order behind round_keys. */
+	if ((size_t) ctx->schedule % 64 != 0 || (size_t) ctx->inv_schedule % 64 != 0) ok = 0;
+	for (r = 0; r <= (int) ctx->nr; r ++)
+	{
+		if (ctx->round_keys[r] != KalynaRoundKey(ctx, r) || ctx->round_keys[r] != ctx->schedule + r * ctx->nb) ok = 0;
+		if (memcmp(ctx->round_keys[r], generic->round_keys[r], ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+		if (memcmp(ctx->inv_round_keys[r], generic->inv_round_keys[r], ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	}
+
+	for (r = 0; r < 16; r ++)
+	{
+		for (i = 0; i < 8; i ++) pt[i] = next_word(&seed);
+		KalynaEncipher(pt, ctx, ct);
+		GenericEncipher(pt, generic, ct_generic);
+		KalynaDecipher(ct, ctx, dt);
+		if (memcmp(ct, ct_generic, ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+		if (memcmp(dt, pt, ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+		GenericDecipher(ct, generic, dt);
+		if (memcmp(dt, pt, ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	}
+
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed kernels\n"); ++failures; }
+	else printf("Success kernels\n");
+
+	KalynaDelete(ctx);
+	KalynaDelete(generic);
 }
 
 
@@ -324,3 +547,1052 @@ void print (int data_size, uint64_t data [])
 	};
 	printf ("\n");
 };
+
+void check_bitsliced (size_t block_size, size_t key_size)
+{
+	/* One full batch of 64 blocks and a partial one. */
+	enum { kBlocks = 70 };
+	size_t i;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8];
+	uint64_t pt[kBlocks * 8], ct[kBlocks * 8], expect[kBlocks * 8];
+	kalyna_t * ctx = KalynaInit(block_size, key_size);
+
+	for (i = 0; i < 8; i ++) key[i] = next_word(&seed);
+	for (i = 0; i < kBlocks * ctx->nb; i ++) pt[i] = next_word(&seed);
+	KalynaKeyExpand(key, ctx);
+
+	for (i = 0; i < kBlocks; i ++) KalynaEncipher(pt + i * ctx->nb, ctx, expect + i * ctx->nb);
+	KalynaBitslicedEncipher(pt, ctx, ct, kBlocks);
+	if (memcmp(ct, expect, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+
+	KalynaBitslicedDecipher(ct, ctx, ct, kBlocks);
+	if (memcmp(ct, pt, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed bitsliced\n"); ++failures; }
+	else printf("Success bitsliced\n");
+
+	KalynaDelete(ctx);
+}
+
+void check_blocks (size_t block_size, size_t key_size)
+{
+	/* Not a multiple of the 64-byte AVX2 unit for any block size. */
+	enum { kBlocks = 13 };
+	size_t i;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8];
+	uint64_t pt[kBlocks * 8], ct[kBlocks * 8], expect[kBlocks * 8];
+	kalyna_t * ctx = KalynaInit(block_size, key_size);
+
+	for (i = 0; i < 8; i ++) key[i] = next_word(&seed);
+	for (i = 0; i < kBlocks * ctx->nb; i ++) pt[i] = next_word(&seed);
+	KalynaKeyExpand(key, ctx);
+
+	for (i = 0; i < kBlocks; i ++) KalynaEncipher(pt + i * ctx->nb, ctx, expect + i * ctx->nb);
+	KalynaEncipherBlocks(pt, ctx, ct, kBlocks);
+	if (memcmp(ct, expect, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	GenericEncipherBlocks(pt, ctx, ct, kBlocks);
+	if (memcmp(ct, expect, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	if (KalynaBackendSupported(KALYNA_BACKEND_AVX2))
+	{
+		Avx2EncipherBlocks(pt, KalynaGetSchedule(ctx), ct, kBlocks);
+		if (memcmp(ct, expect, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+		Avx2DecipherBlocks(ct, KalynaGetSchedule(ctx), ct, kBlocks);
+		if (memcmp(ct, pt, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	}
+	if (KalynaBackendSupported(KALYNA_BACKEND_GFNI))
+	{
+		GfniEncipherBlocks(pt, KalynaGetSchedule(ctx), ct, kBlocks);
+		if (memcmp(ct, expect, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+		GfniDecipherBlocks(ct, KalynaGetSchedule(ctx), ct, kBlocks);
+		if (memcmp(ct, pt, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	}
+	/* In place. */
+	memcpy(ct, pt, kBlocks * ctx->nb * sizeof(uint64_t));
+	KalynaEncipherBlocks(ct, ctx, ct, kBlocks);
+	if (memcmp(ct, expect, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+
+	KalynaDecipherBlocks(ct, ctx, ct, kBlocks);
+	if (memcmp(ct, pt, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	GenericDecipherBlocks(expect, ctx, expect, kBlocks);
+	if (memcmp(expect, pt, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed blocks\n"); ++failures; }
+	else printf("Success blocks\n");
+
+	KalynaDelete(ctx);
+}
+
+/* gf2p8affineqb on one byte with zero constant. */
+static uint8_t gfni_affine (uint64_t matrix, uint8_t x)
+{
+	int i, b, parity;
+	uint8_t result = 0;
+	for (i = 0; i < 8; i ++)
+	{
+		parity = 0;
+		for (b = 0; b < 8; b ++) parity ^= ((matrix >> ((7 - i) * 8 + b)) & (x >> b)) & 1;
+		result |= parity << i;
+	}
+	return result;
+}
+
+void check_gfni_matrices (void)
+{
+	int row, col, x, ok = 1;
+	for (row = 0; row < 8; row ++)
+	{
+		for (col = 0; col < 8; col ++)
+		{
+			for (x = 0; x < 256; x ++)
+			{
+				if (gfni_affine(GfniMatrix(mds_matrix[row][col]), x) != MultiplyGF(mds_matrix[row][col], x)) ok = 0;
+				if (gfni_affine(GfniMatrix(mds_inv_matrix[row][col]), x) != MultiplyGF(mds_inv_matrix[row][col], x)) ok = 0;
+			}
+		}
+	}
+	if (!ok) { printf("Failed GFNI matrices\n"); ++failures; }
+	else printf("Success GFNI matrices\n");
+}
+
+void check_backends (size_t block_size, size_t key_size)
+{
+	enum { kBlocks = 5 };
+	size_t i;
+	int b, ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8];
+	uint64_t pt[kBlocks * 8], ct[kBlocks * 8], dt[kBlocks * 8], expect[kBlocks * 8];
+	uint64_t iv[8], stream[kBlocks * 8];
+	uint64_t cbc[2 * kBlocks * 8], cbc_expect[2 * kBlocks * 8];
+	kalyna_cbc_stream_t streams[2];
+	kalyna_t * ctx = KalynaInit(block_size, key_size);
+	kalyna_t * generic = KalynaInit(block_size, key_size);
+
+	for (i = 0; i < 8; i ++) key[i] = next_word(&seed);
+	for (i = 0; i < 8; i ++) iv[i] = next_word(&seed);
+	for (i = 0; i < kBlocks * ctx->nb; i ++) pt[i] = next_word(&seed);
+	GenericKeyExpand(key, generic);
+	for (i = 0; i < kBlocks; i ++) GenericEncipher(pt + i * ctx->nb, generic, expect + i * ctx->nb);
+	KalynaCtrCrypt((const uint8_t *) pt, generic, iv, (uint8_t *) stream, kBlocks * ctx->nb * sizeof(uint64_t) - 3);
+
+	printf("Kalyna (%lu, %lu):", block_size, key_size);
+	for (b = KALYNA_BACKEND_AUTO; b <= KALYNA_BACKEND_BITSLICED; b ++)
+	{
+		if (!KalynaBackendSupported((kalyna_backend_t) b))
+		{
+			if (KalynaSetBackend(ctx, (kalyna_backend_t) b) == 0) ok = 0;
+			continue;
+		}
+		if (KalynaSetBackend(ctx, (kalyna_backend_t) b) != 0) ok = 0;
+		KalynaKeyExpand(key, ctx);
+		KalynaEncipher(pt, ctx, ct);
+		if (memcmp(ct, expect, ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+		KalynaEncipherBlocks(pt, ctx, ct, kBlocks);
+		if (memcmp(ct, expect, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+		KalynaDecipherBlocks(ct, ctx, dt, kBlocks);
+		if (memcmp(dt, pt, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+		KalynaDecipher(ct, ctx, dt);
+		if (memcmp(dt, pt, ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+		KalynaCtrCrypt((const uint8_t *) pt, ctx, iv, (uint8_t *) ct, kBlocks * ctx->nb * sizeof(uint64_t) - 3);
+		if (memcmp(ct, stream, kBlocks * ctx->nb * sizeof(uint64_t) - 3) != 0) ok = 0;
+		/* Two messages of different lengths against serial CBC. */
+		KalynaCbcEncipher(pt, ctx, iv, cbc_expect, kBlocks);
+		KalynaCbcEncipher(pt + ctx->nb, ctx, pt, cbc_expect + kBlocks * ctx->nb, kBlocks - 2);
+		streams[0] = (kalyna_cbc_stream_t) {ctx, iv, pt, cbc, kBlocks};
+		streams[1] = (kalyna_cbc_stream_t) {ctx, pt, pt + ctx->nb, cbc + kBlocks * ctx->nb, kBlocks - 2};
+		if (KalynaCbcEncipherStreams(streams, 2) != 0) ok = 0;
+		if (memcmp(cbc, cbc_expect, (2 * kBlocks - 2) * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+		printf(" %s", KalynaBackendName((kalyna_backend_t) b));
+	}
+	if (!ok) { printf(" Failed backends\n"); ++failures; }
+	else printf(" Success backends\n");
+
+	KalynaDelete(ctx);
+	KalynaDelete(generic);
+}
+
+void check_buffer (size_t block_size, size_t key_size)
+{
+	size_t i;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8], pt[8], ct[8], expect[8];
+	/* Used from byte 1 on, so the context has to align itself. */
+	uint64_t buffer[4096 / sizeof(uint64_t)];
+	size_t size = KalynaContextSize(block_size, key_size);
+	kalyna_t * heap = KalynaInit(block_size, key_size);
+	kalyna_t * ctx;
+
+	if (size == 0 || size + 1 > sizeof(buffer)) ok = 0;
+	if (KalynaInitBuffer((uint8_t *) buffer + 1, size - 1, block_size, key_size) != NULL) ok = 0;
+	ctx = KalynaInitBuffer((uint8_t *) buffer + 1, size, block_size, key_size);
+	if (ctx == NULL || ctx->memory != NULL || (size_t) ctx->schedule % 64 != 0) { ok = 0; ctx = heap; }
+
+	for (i = 0; i < 8; i ++) key[i] = next_word(&seed);
+	for (i = 0; i < 8; i ++) pt[i] = next_word(&seed);
+	KalynaKeyExpand(key, heap);
+	KalynaKeyExpand(key, ctx);
+	KalynaEncipher(pt, heap, expect);
+	KalynaEncipher(pt, ctx, ct);
+	if (memcmp(ct, expect, ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	KalynaDecipher(ct, ctx, ct);
+	if (memcmp(ct, pt, ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+
+	printf("Kalyna (%lu, %lu): %lu bytes ", block_size, key_size, size);
+	if (!ok) { printf("Failed caller storage\n"); ++failures; }
+	else printf("Success caller storage\n");
+
+	if (ctx != heap) KalynaDelete(ctx);
+	KalynaDelete(heap);
+}
+
+enum { kScheduleThreads = 4, kScheduleBlocks = 256 };
+
+typedef struct
+{
+	const kalyna_schedule_t * schedule;
+	const uint64_t * pt;
+	const uint64_t * expect;
+	int ok;
+} schedule_job_t;
+
+static void * schedule_worker (void * arg)
+{
+	schedule_job_t * job = (schedule_job_t *) arg;
+	const kalyna_schedule_t * schedule = job->schedule;
+	uint64_t ct[kScheduleBlocks * 8], dt[8];
+	size_t i, round;
+
+	job->ok = 1;
+	for (round = 0; round < 16; round ++)
+	{
+		KalynaScheduleEncipherBlocks(job->pt, schedule, ct, kScheduleBlocks);
+		if (memcmp(ct, job->expect, kScheduleBlocks * schedule->nb * sizeof(uint64_t)) != 0) job->ok = 0;
+		for (i = 0; i < kScheduleBlocks; i ++)
+		{
+			KalynaScheduleEncipher(job->pt + i * schedule->nb, schedule, dt);
+			if (memcmp(dt, job->expect + i * schedule->nb, schedule->nb * sizeof(uint64_t)) != 0) job->ok = 0;
+			KalynaScheduleDecipher(dt, schedule, dt);
+			if (memcmp(dt, job->pt + i * schedule->nb, schedule->nb * sizeof(uint64_t)) != 0) job->ok = 0;
+		}
+		KalynaScheduleDecipherBlocks(ct, schedule, ct, kScheduleBlocks);
+		if (memcmp(ct, job->pt, kScheduleBlocks * schedule->nb * sizeof(uint64_t)) != 0) job->ok = 0;
+	}
+	return NULL;
+}
+
+void check_schedule (size_t block_size, size_t key_size)
+{
+	size_t i;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8], state[8];
+	static uint64_t pt[kScheduleBlocks * 8], expect[kScheduleBlocks * 8];
+	pthread_t threads[kScheduleThreads];
+	schedule_job_t jobs[kScheduleThreads];
+	kalyna_t * ctx = KalynaInit(block_size, key_size);
+
+	for (i = 0; i < 8; i ++) key[i] = next_word(&seed);
+	for (i = 0; i < kScheduleBlocks * ctx->nb; i ++) pt[i] = next_word(&seed);
+	KalynaKeyExpand(key, ctx);
+	for (i = 0; i < kScheduleBlocks; i ++) KalynaEncipher(pt + i * ctx->nb, ctx, expect + i * ctx->nb);
+
+	/* The schedule functions must not write to the context. */
+	memcpy(state, ctx->state, ctx->nb * sizeof(uint64_t));
+	for (i = 0; i < kScheduleThreads; i ++)
+	{
+		jobs[i].schedule = KalynaGetSchedule(ctx);
+		jobs[i].pt = pt;
+		jobs[i].expect = expect;
+		if (pthread_create(&threads[i], NULL, schedule_worker, &jobs[i]) != 0) { ok = 0; jobs[i].schedule = NULL; }
+	}
+	for (i = 0; i < kScheduleThreads; i ++)
+	{
+		if (jobs[i].schedule == NULL) continue;
+		pthread_join(threads[i], NULL);
+		if (!jobs[i].ok) ok = 0;
+	}
+	if (memcmp(state, ctx->state, ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed shared schedule\n"); ++failures; }
+	else printf("Success shared schedule\n");
+
+	KalynaDelete(ctx);
+}
+
+void check_key_batch (size_t block_size, size_t key_size)
+{
+	/* Not a multiple of the lane count. */
+	enum { kKeys = 7 };
+	size_t i, r;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t keys[kKeys * 8];
+	kalyna_t * batch[kKeys];
+	kalyna_t * last;
+	kalyna_t * single = KalynaInit(block_size, key_size);
+	kalyna_t * other = KalynaInit(block_size == 512 ? 256 : 512, 512);
+
+	for (i = 0; i < kKeys * 8; i ++) keys[i] = next_word(&seed);
+	for (i = 0; i < kKeys; i ++) batch[i] = KalynaInit(block_size, key_size);
+	if (KalynaKeyExpandBatch(keys, batch, kKeys) != 0) ok = 0;
+	for (i = 0; i < kKeys; i ++)
+	{
+		KalynaKeyExpand(keys + i * single->nk, single);
+		for (r = 0; r <= single->nr; r ++)
+		{
+			if (memcmp(single->round_keys[r], batch[i]->round_keys[r], single->nb * sizeof(uint64_t)) != 0) ok = 0;
+			if (memcmp(single->inv_round_keys[r], batch[i]->inv_round_keys[r], single->nb * sizeof(uint64_t)) != 0) ok = 0;
+		}
+	}
+	/* Mixed variants are rejected. */
+	last = batch[kKeys - 1];
+	batch[kKeys - 1] = other;
+	if (KalynaKeyExpandBatch(keys, batch, kKeys) != -1) ok = 0;
+	batch[kKeys - 1] = last;
+
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed batched key expansion\n"); ++failures; }
+	else printf("Success batched key expansion\n");
+
+	for (i = 0; i < kKeys; i ++) KalynaDelete(batch[i]);
+	KalynaDelete(single);
+	KalynaDelete(other);
+}
+
+void check_one_shot (size_t block_size, size_t key_size)
+{
+	enum { kBlocks = 3 };
+	size_t i;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8], pt[kBlocks * 8], ct[kBlocks * 8], expect[kBlocks * 8];
+	kalyna_t * ctx = KalynaInit(block_size, key_size);
+
+	for (i = 0; i < 8; i ++) key[i] = next_word(&seed);
+	for (i = 0; i < kBlocks * 8; i ++) pt[i] = next_word(&seed);
+	KalynaKeyExpand(key, ctx);
+	KalynaEncipherBlocks(pt, ctx, expect, kBlocks);
+
+	if (KalynaEncipherOneShot(block_size, key_size, key, pt, ct, 1) != 0) ok = 0;
+	if (memcmp(ct, expect, ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	/* In place, several blocks. */
+	memcpy(ct, pt, sizeof(ct));
+	if (KalynaEncipherOneShot(block_size, key_size, key, ct, ct, kBlocks) != 0) ok = 0;
+	if (memcmp(ct, expect, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	if (KalynaEncipherOneShot(512, 256, key, pt, ct, 1) != -1) ok = 0;
+
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed one-shot encipher\n"); ++failures; }
+	else printf("Success one-shot encipher\n");
+
+	KalynaDelete(ctx);
+}
+
+void check_compact_schedule (size_t block_size, size_t key_size)
+{
+	enum { kBlocks = 5 };
+	size_t i, r;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8], pt[kBlocks * 8], ct[kBlocks * 8], expect[kBlocks * 8];
+	/* Odd offset: the schedule is word aligned inside the buffer. */
+	uint8_t storage[1024 + 1];
+	kalyna_schedule_t * compact;
+	kalyna_t * ctx = KalynaInit(block_size, key_size);
+
+	for (i = 0; i < 8; i ++) key[i] = next_word(&seed);
+	for (i = 0; i < kBlocks * 8; i ++) pt[i] = next_word(&seed);
+	KalynaKeyExpand(key, ctx);
+	KalynaEncipherBlocks(pt, ctx, expect, kBlocks);
+
+	if (KalynaCompactScheduleSize(block_size, key_size) + 1 > sizeof(storage)) ok = 0;
+	compact = KalynaCompactScheduleInit(storage + 1, sizeof(storage) - 1, block_size, key_size, key);
+	if (compact == NULL || (size_t)compact % sizeof(uint64_t) != 0) { ok = 0; goto done; }
+	for (r = 0; r <= ctx->nr; r += 2)
+		if (memcmp(compact->round_keys + r / 2 * ctx->nb, KalynaRoundKey(ctx, r), ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	KalynaScheduleEncipherBlocks(pt, compact, ct, kBlocks);
+	if (memcmp(ct, expect, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	KalynaScheduleDecipherBlocks(ct, compact, ct, kBlocks);
+	if (memcmp(ct, pt, kBlocks * ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	KalynaCompactScheduleWipe(compact);
+	for (i = 0; i < (ctx->nr / 2 + 1) * ctx->nb; i ++)
+		if (compact->round_keys[i] != 0) ok = 0;
+	if (KalynaCompactScheduleInit(storage, 16, block_size, key_size, key) != NULL) ok = 0;
+
+done:
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed compact schedule\n"); ++failures; }
+	else printf("Success compact schedule\n");
+
+	KalynaDelete(ctx);
+}
+
+enum { kCacheKeys = 8, kCacheCapacity = 4, kCacheThreads = 4, kCacheRequests = 500 };
+
+static const size_t cache_variants[5][2] = {{128, 128}, {128, 256}, {256, 256}, {256, 512}, {512, 512}};
+
+typedef struct {
+	kalyna_cache_t * cache;
+	uint64_t (* keys)[8];
+	uint64_t (* expect)[8];
+	uint64_t seed;
+	int ok;
+} cache_job_t;
+
+static void * cache_worker (void * arg)
+{
+	cache_job_t * job = (cache_job_t *) arg;
+	const kalyna_schedule_t * schedule;
+	uint64_t pt[8] = {0}, ct[8];
+	size_t n, k;
+
+	job->ok = 1;
+	for (n = 0; n < kCacheRequests; n ++)
+	{
+		k = next_word(&job->seed) >> 33 & (kCacheKeys - 1);
+		schedule = KalynaCacheAcquire(job->cache, cache_variants[k % 5][0], cache_variants[k % 5][1], job->keys[k]);
+		/* Every thread holds at most one schedule, never all slots. */
+		if (schedule == NULL) { job->ok = 0; continue; }
+		KalynaScheduleEncipher(pt, schedule, ct);
+		if (memcmp(ct, job->expect[k], schedule->nb * sizeof(uint64_t)) != 0) job->ok = 0;
+		KalynaCacheRelease(job->cache, schedule);
+	}
+	return NULL;
+}
+
+void check_cache (void)
+{
+	size_t i, w;
+	int ok = 1;
+	uint64_t seed = 16;
+	uint64_t keys[kCacheKeys][8], expect[kCacheKeys][8], pt[8] = {0};
+	const kalyna_schedule_t * pinned[kCacheCapacity];
+	const kalyna_schedule_t * schedule;
+	pthread_t threads[kCacheThreads];
+	cache_job_t jobs[kCacheThreads];
+	kalyna_cache_stats_t stats;
+	kalyna_cache_t * cache = KalynaCacheCreate(kCacheCapacity);
+	kalyna_t * ctx;
+
+	for (i = 0; i < kCacheKeys; i ++)
+	{
+		ctx = KalynaInit(cache_variants[i % 5][0], cache_variants[i % 5][1]);
+		for (w = 0; w < 8; w ++) keys[i][w] = next_word(&seed);
+		KalynaKeyExpand(keys[i], ctx);
+		KalynaEncipher(pt, ctx, expect[i]);
+		KalynaDelete(ctx);
+	}
+
+	/* Unsupported sizes are rejected without counting, then miss and hit. */
+	if (KalynaCacheAcquire(cache, 128, 512, keys[0]) != NULL) ok = 0;
+	schedule = KalynaCacheAcquire(cache, 128, 128, keys[0]);
+	KalynaCacheRelease(cache, schedule);
+	if (KalynaCacheAcquire(cache, 128, 128, keys[0]) != schedule) ok = 0;
+	KalynaCacheRelease(cache, schedule);
+	KalynaCacheStats(cache, &stats);
+	if (stats.hits != 1 || stats.misses != 1 || stats.evictions != 0) ok = 0;
+
+	/* Same key words, other variant: a different schedule. */
+	schedule = KalynaCacheAcquire(cache, 128, 256, keys[0]);
+	if (schedule == NULL || schedule->nk != 4) ok = 0;
+	else KalynaCacheRelease(cache, schedule);
+
+	/* Pinned schedules are never evicted. */
+	for (i = 0; i < kCacheCapacity; i ++)
+		pinned[i] = KalynaCacheAcquire(cache, cache_variants[i % 5][0], cache_variants[i % 5][1], keys[i]);
+	if (KalynaCacheAcquire(cache, cache_variants[4][0], cache_variants[4][1], keys[4]) != NULL) ok = 0;
+	for (i = 0; i < kCacheCapacity; i ++)
+	{
+		if (pinned[i] == NULL) ok = 0;
+		else KalynaCacheRelease(cache, pinned[i]);
+	}
+
+	for (i = 0; i < kCacheThreads; i ++)
+	{
+		jobs[i].cache = cache;
+		jobs[i].keys = keys;
+		jobs[i].expect = expect;
+		jobs[i].seed = i + 1;
+		if (pthread_create(&threads[i], NULL, cache_worker, &jobs[i]) != 0) { ok = 0; jobs[i].cache = NULL; }
+	}
+	for (i = 0; i < kCacheThreads; i ++)
+	{
+		if (jobs[i].cache == NULL) continue;
+		pthread_join(threads[i], NULL);
+		if (!jobs[i].ok) ok = 0;
+	}
+	KalynaCacheStats(cache, &stats);
+	if (stats.hits + stats.misses != 2 + 1 + kCacheCapacity + 1 + kCacheThreads * kCacheRequests) ok = 0;
+	if (stats.evictions == 0 || stats.hits == 0) ok = 0;
+
+	printf("Mixed variants: ");
+	if (!ok) { printf("Failed schedule cache\n"); ++failures; }
+	else printf("Success schedule cache (%lu hits, %lu misses, %lu evictions)\n",
+		(unsigned long) stats.hits, (unsigned long) stats.misses, (unsigned long) stats.evictions);
+
+	KalynaCacheDestroy(cache);
+}
+
+enum { kRegistryKeys = 4, kRegistryReaders = 3, kRegistryRotations = 300, kRegistryRequests = 20000 };
+
+typedef struct {
+	kalyna_registry_t * registry;
+	size_t reader;
+	uint64_t (* expect)[2];
+	int ok;
+} registry_job_t;
+
+static void * registry_worker (void * arg)
+{
+	registry_job_t * job = (registry_job_t *) arg;
+	const kalyna_schedule_t * schedule;
+	uint64_t pt[2] = {0}, ct[2], again[2];
+	size_t n, k;
+
+	job->ok = 1;
+	for (n = 0; n < kRegistryRequests; n ++)
+	{
+		schedule = KalynaRegistryEnter(job->registry, job->reader);
+		KalynaScheduleEncipher(pt, schedule, ct);
+		KalynaScheduleEncipher(pt, schedule, again);
+		KalynaRegistryExit(job->registry, job->reader);
+		/* One of the rotated keys, not reclaimed while held. */
+		for (k = 0; k < kRegistryKeys; k ++)
+			if (memcmp(ct, job->expect[k], sizeof(ct)) == 0) break;
+		if (k == kRegistryKeys || memcmp(ct, again, sizeof(ct)) != 0) job->ok = 0;
+	}
+	return NULL;
+}
+
+void check_registry (void)
+{
+	size_t i;
+	int ok = 1;
+	uint64_t keys[kRegistryKeys][2], expect[kRegistryKeys][2], pt[2] = {0}, ct[2];
+	const kalyna_schedule_t * held;
+	pthread_t threads[kRegistryReaders];
+	registry_job_t jobs[kRegistryReaders];
+	kalyna_registry_t * registry;
+	kalyna_t * ctx = KalynaInit(128, 128);
+
+	for (i = 0; i < kRegistryKeys; i ++)
+	{
+		keys[i][0] = 0x0706050403020100ULL * (i + 1);
+		keys[i][1] = 0x0f0e0d0c0b0a0908ULL * (i + 1);
+		KalynaKeyExpand(keys[i], ctx);
+		KalynaEncipher(pt, ctx, expect[i]);
+	}
+	registry = KalynaRegistryCreate(128, 128, keys[0], kRegistryReaders);
+
+	/* A held schedule outlives its rotation until the reader exits. */
+	held = KalynaRegistryEnter(registry, 0);
+	KalynaRegistryRotate(registry, keys[1]);
+	if (KalynaRegistryReclaim(registry) != 1) ok = 0;
+	KalynaScheduleEncipher(pt, held, ct);
+	if (memcmp(ct, expect[0], sizeof(ct)) != 0) ok = 0;
+	KalynaRegistryExit(registry, 0);
+	if (KalynaRegistryReclaim(registry) != 0) ok = 0;
+	KalynaScheduleEncipher(pt, KalynaRegistryEnter(registry, 0), ct);
+	KalynaRegistryExit(registry, 0);
+	if (memcmp(ct, expect[1], sizeof(ct)) != 0) ok = 0;
+
+	for (i = 0; i < kRegistryReaders; i ++)
+	{
+		jobs[i].registry = registry;
+		jobs[i].reader = i;
+		jobs[i].expect = expect;
+		if (pthread_create(&threads[i], NULL, registry_worker, &jobs[i]) != 0) { ok = 0; jobs[i].registry = NULL; }
+	}
+	for (i = 0; i < kRegistryRotations; i ++)
+		if (KalynaRegistryRotate(registry, keys[i % kRegistryKeys]) != 0) ok = 0;
+	for (i = 0; i < kRegistryReaders; i ++)
+	{
+		if (jobs[i].registry == NULL) continue;
+		pthread_join(threads[i], NULL);
+		if (!jobs[i].ok) ok = 0;
+	}
+	if (KalynaRegistryReclaim(registry) != 0) ok = 0;
+
+	printf("Kalyna (128, 128): ");
+	if (!ok) { printf("Failed key registry\n"); ++failures; }
+	else printf("Success key registry\n");
+
+	KalynaRegistryDestroy(registry);
+	KalynaDelete(ctx);
+}
+
+void check_snapshot (void)
+{
+	enum { kSnapshotBlocks = 3 };
+	size_t i, w, size;
+	int ok = 1;
+	uint64_t seed = 18;
+	uint64_t key[8], pt[kSnapshotBlocks * 8], ct[kSnapshotBlocks * 8], expect[kSnapshotBlocks * 8];
+	uint64_t * snapshot;
+	kalyna_t * ctxs[5];
+	const kalyna_schedule_t * sources[5];
+	kalyna_schedule_t opened[5];
+
+	for (i = 0; i < kSnapshotBlocks * 8; i ++) pt[i] = next_word(&seed);
+	for (i = 0; i < 5; i ++)
+	{
+		ctxs[i] = KalynaInit(cache_variants[i][0], cache_variants[i][1]);
+		for (w = 0; w < 8; w ++) key[w] = next_word(&seed);
+		KalynaKeyExpand(key, ctxs[i]);
+		sources[i] = KalynaGetSchedule(ctxs[i]);
+	}
+	size = KalynaSnapshotSize(sources, 5);
+	snapshot = (uint64_t *) malloc(size);
+	if (KalynaSnapshotWrite(sources, 5, snapshot, size) != 0) ok = 0;
+	if (KalynaSnapshotOpen(snapshot, size, opened, 5) != 5) ok = 0;
+	else for (i = 0; i < 5; i ++)
+	{
+		/* Used in place, same results as the expanded keys. */
+		if (opened[i].round_keys < snapshot || opened[i].round_keys >= snapshot + size / 8) ok = 0;
+		KalynaEncipherBlocks(pt, ctxs[i], expect, kSnapshotBlocks);
+		KalynaScheduleEncipherBlocks(pt, &opened[i], ct, kSnapshotBlocks);
+		if (memcmp(ct, expect, kSnapshotBlocks * ctxs[i]->nb * sizeof(uint64_t)) != 0) ok = 0;
+		KalynaScheduleDecipherBlocks(ct, &opened[i], ct, kSnapshotBlocks);
+		if (memcmp(ct, pt, kSnapshotBlocks * ctxs[i]->nb * sizeof(uint64_t)) != 0) ok = 0;
+	}
+
+	/* Rejected: too many schedules, truncation, corruption, other version. */
+	if (KalynaSnapshotOpen(snapshot, size, opened, 4) != -1) ok = 0;
+	if (KalynaSnapshotOpen(snapshot, size - 8, opened, 5) != -1) ok = 0;
+	snapshot[size / 8 - 1] ^= 1;
+	if (KalynaSnapshotOpen(snapshot, size, opened, 5) != -1) ok = 0;
+	snapshot[size / 8 - 1] ^= 1;
+	snapshot[1] ++;
+	if (KalynaSnapshotOpen(snapshot, size, opened, 5) != -1) ok = 0;
+
+	printf("Mixed variants: ");
+	if (!ok) { printf("Failed snapshot\n"); ++failures; }
+	else printf("Success snapshot\n");
+
+	memset(snapshot, 0, size);
+	free(snapshot);
+	for (i = 0; i < 5; i ++) KalynaDelete(ctxs[i]);
+}
+
+enum { kStoreIds = 8 };
+
+/* Encipher a zero block with the schedule stored under `id`. */
+static int store_encipher (const kalyna_store_t * store, uint64_t id, uint64_t * ct)
+{
+	kalyna_schedule_t schedule;
+	uint64_t generation, pt[4] = {0};
+	if (KalynaStoreLookup(store, id, &schedule, &generation) != 0) return -1;
+	KalynaScheduleEncipher(pt, &schedule, ct);
+	return KalynaStoreValidate(store, &schedule, generation) ? 0 : -1;
+}
+
+void check_store (void)
+{
+	size_t i, w;
+	int ok = 1, status;
+	uint64_t seed = 19;
+	uint64_t keys[kStoreIds + 2][4], expect[kStoreIds + 2][4], pt[4] = {0}, ct[4], generation;
+	size_t size = KalynaStoreSize(2 * kStoreIds, 256, 256);
+	void * region = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	uint64_t small[64 * 8];
+	kalyna_store_t * store;
+	kalyna_schedule_t held;
+	pid_t child;
+	kalyna_t * ctx = KalynaInit(256, 256);
+
+	for (i = 0; i < kStoreIds + 2; i ++)
+	{
+		for (w = 0; w < 4; w ++) keys[i][w] = next_word(&seed);
+		KalynaKeyExpand(keys[i], ctx);
+		KalynaEncipher(pt, ctx, expect[i]);
+	}
+	store = KalynaStoreCreate(region, size, 2 * kStoreIds, 256, 256);
+	if (store == NULL) { ok = 0; goto done; }
+	for (i = 0; i < kStoreIds; i ++)
+		if (KalynaStorePut(store, i + 1, keys[i]) != 0) ok = 0;
+	if (KalynaStorePut(store, 0, keys[0]) != -1) ok = 0;
+
+	/* A worker process maps the store read-only. */
+	child = fork();
+	if (child == 0)
+	{
+		const kalyna_store_t * attached;
+		mprotect(region, size, PROT_READ);
+		attached = KalynaStoreAttach(region, size);
+		for (i = 0; i < kStoreIds; i ++)
+			if (attached == NULL || store_encipher(attached, i + 1, ct) != 0 || memcmp(ct, expect[i], sizeof(ct)) != 0)
+				_exit(1);
+		_exit(0);
+	}
+	if (child < 0 || waitpid(child, &status, 0) != child || !WIFEXITED(status) || WEXITSTATUS(status) != 0) ok = 0;
+
+	/* Replacing a key keeps the buffer in use for one more update. */
+	if (KalynaStoreLookup(store, 3, &held, &generation) != 0) ok = 0;
+	KalynaStorePut(store, 3, keys[kStoreIds]);
+	if (!KalynaStoreValidate(store, &held, generation)) ok = 0;
+	if (store_encipher(store, 3, ct) != 0 || memcmp(ct, expect[kStoreIds], sizeof(ct)) != 0) ok = 0;
+	KalynaStorePut(store, 3, keys[2]);
+	if (KalynaStoreValidate(store, &held, generation)) ok = 0;
+	if (store_encipher(store, 3, ct) != 0 || memcmp(ct, expect[2], sizeof(ct)) != 0) ok = 0;
+
+	/* Removed schedules are wiped, the slot is reused. */
+	if (KalynaStoreLookup(store, 5, &held, &generation) != 0) ok = 0;
+	if (KalynaStoreRemove(store, 5) != 0 || KalynaStoreRemove(store, 5) != -1) ok = 0;
+	if (KalynaStoreValidate(store, &held, generation)) ok = 0;
+	if (store_encipher(store, 5, ct) != -1) ok = 0;
+	if (KalynaStorePut(store, 5, keys[kStoreIds + 1]) != 0) ok = 0;
+	if (store_encipher(store, 5, ct) != 0 || memcmp(ct, expect[kStoreIds + 1], sizeof(ct)) != 0) ok = 0;
+
+	/* Full store, foreign region. */
+	store = KalynaStoreCreate((void *)(((size_t) small + 63) & ~(size_t) 63), sizeof(small) - 64, 1, 128, 128);
+	if (store == NULL || KalynaStorePut(store, 1, keys[0]) != 0 || KalynaStorePut(store, 2, keys[1]) != -1) ok = 0;
+	if (KalynaStoreAttach(pt, sizeof(small)) != NULL) ok = 0;
+
+done:
+	printf("Kalyna (256, 256): ");
+	if (!ok) { printf("Failed shared store\n"); ++failures; }
+	else printf("Success shared store\n");
+
+	munmap(region, size);
+	KalynaDelete(ctx);
+}
+
+void check_pool (size_t block_size, size_t key_size)
+{
+	/* More contexts than a slab holds. */
+	enum { kPoolSlab = 4, kPoolContexts = 10 };
+	size_t i, j, w;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8], pt[8] = {0}, ct[8], expect[8];
+	const uint64_t * keys;
+	kalyna_t * contexts[kPoolContexts];
+	kalyna_t * reused;
+	kalyna_t * ctx = KalynaInit(block_size, key_size);
+	kalyna_pool_t * pool = KalynaPoolCreate(block_size, key_size, kPoolSlab);
+
+	for (w = 0; w < 8; w ++) key[w] = next_word(&seed);
+	KalynaKeyExpand(key, ctx);
+	KalynaEncipher(pt, ctx, expect);
+
+	for (i = 0; i < kPoolContexts; i ++)
+	{
+		contexts[i] = KalynaPoolAcquire(pool);
+		if (contexts[i] == NULL || (size_t) contexts[i] % 64 != 0) { ok = 0; continue; }
+		for (j = 0; j < i; j ++) if (contexts[j] == contexts[i]) ok = 0;
+		KalynaKeyExpand(key, contexts[i]);
+		KalynaEncipher(pt, contexts[i], ct);
+		if (memcmp(ct, expect, ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+	}
+	if (!ok) goto done;
+
+	/* Released slots are wiped and handed out again. */
+	keys = KalynaRoundKey(contexts[3], 0);
+	KalynaPoolRelease(pool, contexts[3]);
+	for (w = 0; w < ctx->nb; w ++) if (keys[w] != 0) ok = 0;
+	reused = KalynaPoolAcquire(pool);
+	if (reused != contexts[3]) ok = 0;
+	KalynaKeyExpand(key, reused);
+	KalynaDecipher(expect, reused, ct);
+	if (memcmp(ct, pt, ctx->nb * sizeof(uint64_t)) != 0) ok = 0;
+
+	/* Bulk release. */
+	keys = KalynaRoundKey(contexts[kPoolContexts - 1], ctx->nr);
+	KalynaPoolReleaseAll(pool);
+	for (w = 0; w < ctx->nb; w ++) if (keys[w] != 0) ok = 0;
+	for (i = 0; i < kPoolContexts; i ++) if (KalynaPoolAcquire(pool) == NULL) ok = 0;
+
+done:
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed context pool\n"); ++failures; }
+	else printf("Success context pool\n");
+
+	KalynaPoolDestroy(pool);
+	KalynaDelete(ctx);
+}
+
+void check_ctr (size_t block_size, size_t key_size)
+{
+	/* Several keystream batches and a partial last block. */
+	enum { kCtrBytes = 3000 };
+	static const size_t lengths[] = {0, 1, 15, 64, 65, kCtrBytes};
+	size_t i, n, w, length;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8], iv[8], counter[8], gamma[8];
+	uint8_t pt[kCtrBytes], ct[kCtrBytes], expect[kCtrBytes];
+	kalyna_t * ctx = KalynaInit(block_size, key_size);
+
+	for (i = 0; i < 8; i ++) key[i] = next_word(&seed);
+	for (i = 0; i < 8; i ++) iv[i] = next_word(&seed);
+	for (i = 0; i < kCtrBytes; i ++) pt[i] = (uint8_t) next_word(&seed);
+	KalynaKeyExpand(key, ctx);
+
+	/* Block by block: counter starts at E(IV), incremented before use. */
+	KalynaEncipher(iv, ctx, counter);
+	for (n = 0; n * ctx->nb * 8 < kCtrBytes; n ++)
+	{
+		for (w = 0; w < ctx->nb && ++counter[w] == 0; w ++);
+		KalynaEncipher(counter, ctx, gamma);
+		for (i = n * ctx->nb * 8; i < (n + 1) * ctx->nb * 8 && i < kCtrBytes; i ++)
+			expect[i] = pt[i] ^ ((uint8_t *) gamma)[i % (ctx->nb * 8)];
+	}
+
+	for (i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i ++)
+	{
+		length = lengths[i];
+		memset(ct, 0, kCtrBytes);
+		KalynaCtrCrypt(pt, ctx, iv, ct, length);
+		if (memcmp(ct, expect, length) != 0 || (length < kCtrBytes && ct[length] != 0)) ok = 0;
+	}
+	/* In place, deciphering is the same operation. */
+	KalynaCtrCrypt(ct, ctx, iv, ct, kCtrBytes);
+	if (memcmp(ct, pt, kCtrBytes) != 0) ok = 0;
+	if (KalynaBackendSupported(KALYNA_BACKEND_AVX2))
+	{
+		KalynaSetBackend(ctx, KALYNA_BACKEND_AVX2);
+		KalynaCtrCrypt(pt, ctx, iv, ct, kCtrBytes);
+		if (memcmp(ct, expect, kCtrBytes) != 0) ok = 0;
+	}
+
+	/* The counter carries across the full block width. */
+	for (w = 0; w < ctx->nb; w ++) counter[w] = ~0ULL;
+	counter[ctx->nb - 1] = 5;
+	CounterAdd(counter, ctx->nb, 1);
+	for (w = 0; w + 1 < ctx->nb; w ++) if (counter[w] != 0) ok = 0;
+	if (counter[ctx->nb - 1] != 6) ok = 0;
+	counter[ctx->nb - 1] = ~0ULL;
+	CounterAdd(counter, ctx->nb, 0);
+	CounterAdd(counter, ctx->nb, 3);
+	if (counter[0] != 3 || counter[ctx->nb - 1] != ~0ULL) ok = 0;
+
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed CTR mode\n"); ++failures; }
+	else printf("Success CTR mode\n");
+
+	KalynaDelete(ctx);
+}
+
+void check_ctr_vector (void)
+{
+	/* DSTU 7624:2014 Kalyna-128/128 counter mode example: a partial last block. */
+	uint64_t key[2] = {0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL};
+	uint64_t iv[2] = {0x1716151413121110ULL, 0x1f1e1d1c1b1a1918ULL};
+	static const uint8_t expect[41] = {
+		0xa9, 0x0a, 0x6b, 0x97, 0x80, 0xab, 0xdf, 0xdf, 0xf6, 0x4d, 0x14, 0xf5, 0x43, 0x9e, 0x88, 0xf2,
+		0x66, 0xdc, 0x50, 0xed, 0xd3, 0x41, 0x52, 0x8d, 0xd5, 0xe6, 0x98, 0xe2, 0xf0, 0x00, 0xce, 0x21,
+		0xf8, 0x72, 0xda, 0xf9, 0xfe, 0x18, 0x11, 0x84, 0x4a};
+	uint8_t pt[41], ct[41];
+	size_t i;
+	kalyna_t * ctx = KalynaInit(128, 128);
+
+	for (i = 0; i < sizeof(pt); i ++) pt[i] = (uint8_t) (0x20 + i);
+	KalynaKeyExpand(key, ctx);
+	KalynaCtrCrypt(pt, ctx, iv, ct, sizeof(pt));
+
+	printf("Kalyna (128, 128): ");
+	if (memcmp(ct, expect, sizeof(expect)) != 0) { printf("Failed CTR known answer\n"); ++failures; }
+	else printf("Success CTR known answer\n");
+
+	KalynaDelete(ctx);
+}
+
+void check_ctr_seek (size_t block_size, size_t key_size)
+{
+	enum { kCtrBytes = 3000 };
+	static const size_t offsets[] = {0, 1, 15, 16, 17, 63, 64, 1023, 1025, 2999};
+	static const size_t lengths[] = {0, 1, 7, 16, 100, 1500};
+	size_t i, j, w, offset, length;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8], iv[8], counter[8], gamma[8];
+	/* 10 GiB into the stream. */
+	uint64_t far = 10ULL << 30;
+	uint8_t pt[kCtrBytes], stream[kCtrBytes], ct[kCtrBytes];
+	kalyna_t * ctx = KalynaInit(block_size, key_size);
+
+	for (i = 0; i < 8; i ++) key[i] = next_word(&seed);
+	for (i = 0; i < 8; i ++) iv[i] = next_word(&seed);
+	for (i = 0; i < kCtrBytes; i ++) pt[i] = (uint8_t) next_word(&seed);
+	KalynaKeyExpand(key, ctx);
+	KalynaCtrCrypt(pt, ctx, iv, stream, kCtrBytes);
+
+	/* Any range matches the same range of the whole stream. */
+	for (i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i ++)
+	{
+		for (j = 0; j < sizeof(lengths) / sizeof(lengths[0]); j ++)
+		{
+			offset = offsets[i];
+			length = offset + lengths[j] > kCtrBytes ? kCtrBytes - offset : lengths[j];
+			KalynaCtrCryptAt(pt + offset, ctx, iv, offset, ct, length);
+			if (memcmp(ct, stream + offset, length) != 0) ok = 0;
+		}
+	}
+
+	/* Far offsets: block far / (8 Nb) + 1 after E(IV), starting 3 bytes in. */
+	KalynaEncipher(iv, ctx, counter);
+	counter[0] += far / (ctx->nb * 8) + 1;
+	KalynaEncipher(counter, ctx, gamma);
+	memset(ct, 0, ctx->nb * 8);
+	KalynaCtrCryptAt(ct, ctx, iv, far + 3, ct, ctx->nb * 8 - 3);
+	if (memcmp(ct, (uint8_t *) gamma + 3, ctx->nb * 8 - 3) != 0) ok = 0;
+
+	/* Unaligned head and tail in place. */
+	memcpy(ct, pt, kCtrBytes);
+	KalynaCtrCryptAt(ct + 5, ctx, iv, 5, ct + 5, kCtrBytes - 10);
+	for (w = 5; w < kCtrBytes - 5; w ++) if (ct[w] != stream[w]) ok = 0;
+	if (memcmp(ct, pt, 5) != 0 || memcmp(ct + kCtrBytes - 5, pt + kCtrBytes - 5, 5) != 0) ok = 0;
+
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed seekable CTR mode\n"); ++failures; }
+	else printf("Success seekable CTR mode\n");
+
+	KalynaDelete(ctx);
+}
+
+void check_cbc (size_t block_size, size_t key_size)
+{
+	/* More blocks than a deciphering batch, not a multiple of it. */
+	enum { kCbcBlocks = 150 };
+	size_t i, w, length, block_bytes;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8], iv[8], block[8];
+	uint64_t pt[kCbcBlocks * 8], ct[kCbcBlocks * 8], expect[kCbcBlocks * 8];
+	uint8_t padded[3 * 64];
+	kalyna_t * ctx = KalynaInit(block_size, key_size);
+
+	block_bytes = ctx->nb * 8;
+	for (i = 0; i < 8; i ++) key[i] = next_word(&seed);
+	for (i = 0; i < 8; i ++) iv[i] = next_word(&seed);
+	for (i = 0; i < kCbcBlocks * ctx->nb; i ++) pt[i] = next_word(&seed);
+	KalynaKeyExpand(key, ctx);
+
+	/* Block by block: C_i = E(P_i ^ C_(i-1)), C_(-1) = IV. */
+	for (i = 0; i < kCbcBlocks; i ++)
+	{
+		for (w = 0; w < ctx->nb; w ++) block[w] = pt[i * ctx->nb + w] ^ (i == 0 ? iv[w] : expect[(i - 1) * ctx->nb + w]);
+		KalynaEncipher(block, ctx, expect + i * ctx->nb);
+	}
+
+	KalynaCbcEncipher(pt, ctx, iv, ct, kCbcBlocks);
+	if (memcmp(ct, expect, kCbcBlocks * block_bytes) != 0) ok = 0;
+	KalynaCbcDecipher(ct, ctx, iv, ct, kCbcBlocks);
+	if (memcmp(ct, pt, kCbcBlocks * block_bytes) != 0) ok = 0;
+	memcpy(ct, pt, kCbcBlocks * block_bytes);
+	KalynaCbcEncipher(ct, ctx, iv, ct, kCbcBlocks);
+	if (memcmp(ct, expect, kCbcBlocks * block_bytes) != 0) ok = 0;
+	KalynaCbcDecipher(expect, ctx, iv, ct, 3);
+	if (memcmp(ct, pt, 3 * block_bytes) != 0) ok = 0;
+
+	/* Padding: 0x80 and zeros, a full block on a boundary. */
+	for (length = 0; length <= 2 * block_bytes; length ++)
+	{
+		memset(padded, 0xAA, sizeof(padded));
+		if (KalynaPad(padded, length, block_size) != (length / block_bytes + 1) * block_bytes) ok = 0;
+		if (padded[length] != 0x80) ok = 0;
+		for (i = length + 1; i < (length / block_bytes + 1) * block_bytes; i ++) if (padded[i] != 0) ok = 0;
+		if (KalynaUnpad(padded, KalynaPaddedLength(length, block_size), block_size, &i) != 0 || i != length) ok = 0;
+	}
+	memset(padded, 0, sizeof(padded));
+	padded[block_bytes - 1] = 0x80;
+	if (KalynaUnpad(padded, 2 * block_bytes, block_size, &i) == 0) ok = 0;
+	padded[2 * block_bytes - 1] = 0x01;
+	if (KalynaUnpad(padded, 2 * block_bytes, block_size, &i) == 0) ok = 0;
+	if (KalynaUnpad(padded, block_bytes + 1, block_size, &i) == 0) ok = 0;
+
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed CBC mode\n"); ++failures; }
+	else printf("Success CBC mode\n");
+
+	KalynaDelete(ctx);
+}
+
+void check_cbc_vector (void)
+{
+	/* DSTU 7624:2014 Kalyna-128/128 cipher block chaining example, first two blocks. */
+	uint64_t key[2] = {0x0706050403020100ULL, 0x0f0e0d0c0b0a0908ULL};
+	uint64_t iv[2] = {0x1716151413121110ULL, 0x1f1e1d1c1b1a1918ULL};
+	static const uint8_t expect[32] = {
+		0xa7, 0x36, 0x25, 0xd7, 0xbe, 0x99, 0x4e, 0x85, 0x46, 0x9a, 0x9f, 0xaa, 0xbc, 0xed, 0xaa, 0xb6,
+		0xdb, 0xc5, 0xf6, 0x5d, 0xd7, 0x7b, 0xb3, 0x5e, 0x06, 0xbd, 0x7d, 0x1d, 0x8e, 0xaf, 0xc8, 0x62};
+	uint64_t pt[4], ct[4], dt[4];
+	size_t i;
+	kalyna_t * ctx = KalynaInit(128, 128);
+
+	for (i = 0; i < sizeof(pt); i ++) ((uint8_t *) pt)[i] = (uint8_t) (0x20 + i);
+	KalynaKeyExpand(key, ctx);
+	KalynaCbcEncipher(pt, ctx, iv, ct, 2);
+	KalynaCbcDecipher(ct, ctx, iv, dt, 2);
+
+	printf("Kalyna (128, 128): ");
+	if (memcmp(ct, expect, sizeof(expect)) != 0 || memcmp(dt, pt, sizeof(pt)) != 0)
+	{
+		printf("Failed CBC known answer\n");
+		++failures;
+	}
+	else printf("Success CBC known answer\n");
+
+	KalynaDelete(ctx);
+}
+
+void check_cbc_streams (size_t block_size, size_t key_size)
+{
+	/* Different lengths (some empty) and keys, more messages than lanes. */
+	enum { kStreams = 11, kMaxBlocks = 9 };
+	static const size_t lengths[kStreams] = {3, 0, 9, 1, 1, 7, 0, 2, 9, 5, 4};
+	size_t i, w;
+	int ok = 1;
+	uint64_t seed = block_size * 1000 + key_size;
+	uint64_t key[8], iv[kStreams][8];
+	uint64_t pt[kStreams][kMaxBlocks * 8], ct[kStreams][kMaxBlocks * 8], expect[kStreams][kMaxBlocks * 8];
+	kalyna_t * contexts[kStreams];
+	kalyna_cbc_stream_t streams[kStreams];
+	kalyna_t * other = block_size == 512 ? KalynaInit(128, 128) : KalynaInit(512, 512);
+
+	for (i = 0; i < kStreams; i ++)
+	{
+		contexts[i] = KalynaInit(block_size, key_size);
+		for (w = 0; w < 8; w ++) key[w] = next_word(&seed);
+		for (w = 0; w < 8; w ++) iv[i][w] = next_word(&seed);
+		for (w = 0; w < kMaxBlocks * 8; w ++) pt[i][w] = next_word(&seed);
+		KalynaKeyExpand(key, contexts[i]);
+		KalynaCbcEncipher(pt[i], contexts[i], iv[i], expect[i], lengths[i]);
+		/* Every other message in place. */
+		memcpy(ct[i], pt[i], sizeof(ct[i]));
+		streams[i].ctx = contexts[i];
+		streams[i].iv = iv[i];
+		streams[i].plaintext = i % 2 ? ct[i] : pt[i];
+		streams[i].ciphertext = ct[i];
+		streams[i].nblocks = lengths[i];
+	}
+
+	if (KalynaCbcEncipherStreams(streams, kStreams) != 0) ok = 0;
+	for (i = 0; i < kStreams; i ++)
+	{
+		if (memcmp(ct[i], expect[i], lengths[i] * contexts[i]->nb * 8) != 0) ok = 0;
+		/* Nothing written past the message. */
+		if (memcmp(ct[i] + lengths[i] * contexts[i]->nb, pt[i] + lengths[i] * contexts[i]->nb,
+			(kMaxBlocks - lengths[i]) * contexts[i]->nb * 8) != 0) ok = 0;
+	}
+	if (KalynaCbcEncipherStreams(streams, 0) != 0) ok = 0;
+
+	/* Mixed variants are rejected. */
+	streams[3].ctx = other;
+	if (KalynaCbcEncipherStreams(streams, kStreams) != -1) ok = 0;
+
+	printf("Kalyna (%lu, %lu): ", block_size, key_size);
+	if (!ok) { printf("Failed CBC streams\n"); ++failures; }
+	else printf("Success CBC streams\n");
+
+	for (i = 0; i < kStreams; i ++) KalynaDelete(contexts[i]);
+	KalynaDelete(other);
+}
@@ -0,0 +1,191 @@
+/*
+
+Modes of operation of the Kalyna block cipher (DSTU 7624:2014)
+
+Counter mode (gamming): the initial counter is the enciphered IV, block i of
+the keystream is the counter plus i + 1 enciphered, the counter being one
+little endian number of the full block width. Keystream blocks are
+independent, so they are generated a batch at a time with the multi-block
+kernel and XORed into the output while still in L1. Block i only depends on
+the counter, so any byte offset is reached by adding its block index to the
+counter, and a partial first block is skipped into.
+
+Cipher block chaining: enciphering is serial, each block is XORed with the
+previous ciphertext block before the cipher. Independent messages are not
+chained to each other though, so many of them are enciphered together with
+one block of each interleaved (see kernel_template.h). Deciphering is not
+serial, a batch of blocks goes through the multi-block kernel and is XORed
+with the ciphertext blocks before it afterwards.
+
+Messages are padded as in DSTU 7624: a 0x80 byte and zero bytes up to the
+block boundary, always at least one byte, so the padding can be removed
+unambiguously.
+
+*/
+
+#include "transformations.h"
+
+
+/* Keystream generated per multi-block call. */
+#define kCTR_BATCH_BYTES 1024
+#define kCTR_BATCH_WORDS (kCTR_BATCH_BYTES / sizeof(uint64_t))
+
+/* Blocks deciphered per multi-block call in CBC mode. */
+#define kCBC_BATCH_BYTES 1024
+#define kCBC_BATCH_WORDS (kCBC_BATCH_BYTES / sizeof(uint64_t))
+
+
+void CounterAdd(uint64_t* counter, size_t nb, uint64_t n) {
+    size_t i;
+    counter[0] += n;
+    if (counter[0] >= n)
+        return;
+    for (i = 1; i < nb && ++counter[i] == 0; ++i)
+        ;
+}
+
+/* output = input ^ gamma for `length` bytes, word by word where possible. */
+static void XorGamma(const uint8_t* input, const uint8_t* gamma, uint8_t* output, size_t length) {
+    size_t i;
+    uint64_t word, key;
+    for (i = 0; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+        memcpy(&word, input + i, sizeof(uint64_t));
+        memcpy(&key, gamma + i, sizeof(uint64_t));
+        word ^= key;
+        memcpy(output + i, &word, sizeof(uint64_t));
+    }
+    for (; i < length; ++i)
+        output[i] = input[i] ^ gamma[i];
+}
+
+void KalynaCtrCryptAt(const uint8_t* input, kalyna_t* ctx, const uint64_t* iv, uint64_t offset,
+                      uint8_t* output, size_t length) {
+    size_t i, nblocks, bytes;
+    size_t block_bytes = ctx->nb * sizeof(uint64_t);
+    /* Bytes of the first keystream block before `offset`. */
+    size_t phase = (size_t)(offset % block_bytes);
+    const kalyna_schedule_t* schedule = &ctx->key_schedule;
+    uint64_t counter[kNB_512];
+    uint64_t gamma[kCTR_BATCH_WORDS];
+
+    /* Counter of the block before the first one used. */
+    schedule->encipher(iv, schedule, counter);
+    CounterAdd(counter, ctx->nb, offset / block_bytes);
+    while (length > 0) {
+        nblocks = (phase + length + block_bytes - 1) / block_bytes;
+        if (nblocks > kCTR_BATCH_BYTES / block_bytes)
+            nblocks = kCTR_BATCH_BYTES / block_bytes;
+        for (i = 0; i < nblocks; ++i) {
+            CounterAdd(counter, ctx->nb, 1);
+            memcpy(gamma + i * ctx->nb, counter, block_bytes);
+        }
+        schedule->encipher_blocks(gamma, schedule, gamma, nblocks);
+        bytes = nblocks * block_bytes - phase;
+        if (bytes > length)
+            bytes = length;
+        XorGamma(input, (const uint8_t*)gamma + phase, output, bytes);
+        input += bytes;
+        output += bytes;
+        length -= bytes;
+        phase = 0;
+    }
+    SecureZero(counter, sizeof(counter));
+    SecureZero(gamma, sizeof(gamma));
+}
+
+void KalynaCtrCrypt(const uint8_t* input, kalyna_t* ctx, const uint64_t* iv, uint8_t* output, size_t length) {
+    KalynaCtrCryptAt(input, ctx, iv, 0, output, length);
+}
+
+void KalynaCbcEncipher(const uint64_t* plaintext, kalyna_t* ctx, const uint64_t* iv, uint64_t* ciphertext,
+                       size_t nblocks) {
+    size_t n, i;
+    const kalyna_schedule_t* schedule = &ctx->key_schedule;
+    const uint64_t* previous = iv;
+    uint64_t block[kNB_512];
+
+    for (n = 0; n < nblocks; ++n) {
+        for (i = 0; i < ctx->nb; ++i)
+            block[i] = plaintext[n * ctx->nb + i] ^ previous[i];
+        schedule->encipher(block, schedule, ciphertext + n * ctx->nb);
+        previous = ciphertext + n * ctx->nb;
+    }
+    SecureZero(block, sizeof(block));
+}
+
+void KalynaCbcDecipher(const uint64_t* ciphertext, kalyna_t* ctx, const uint64_t* iv, uint64_t* plaintext,
+                       size_t nblocks) {
+    size_t n, i, batch, words;
+    size_t nb = ctx->nb;
+    const kalyna_schedule_t* schedule = &ctx->key_schedule;
+    uint64_t previous[kNB_512], next[kNB_512];
+    uint64_t decrypted[kCBC_BATCH_WORDS];
+
+    memcpy(previous, iv, nb * sizeof(uint64_t));
+    for (n = 0; n < nblocks; n += batch) {
+        batch = nblocks - n < kCBC_BATCH_WORDS / nb ? nblocks - n : kCBC_BATCH_WORDS / nb;
+        words = batch * nb;
+        schedule->decipher_blocks(ciphertext + n * nb, schedule, decrypted, batch);
+        /* Backwards, so in place every ciphertext block is read before it
+         * is overwritten. */
+        memcpy(next, ciphertext + n * nb + words - nb, nb * sizeof(uint64_t));
+        for (i = words; i-- > nb; )
+            plaintext[n * nb + i] = decrypted[i] ^ ciphertext[n * nb + i - nb];
+        for (i = 0; i < nb; ++i)
+            plaintext[n * nb + i] = decrypted[i] ^ previous[i];
+        memcpy(previous, next, nb * sizeof(uint64_t));
+    }
+    SecureZero(decrypted, sizeof(decrypted));
+}
+
+int KalynaCbcEncipherStreams(const kalyna_cbc_stream_t* streams, size_t count) {
+    size_t i;
+    if (count == 0)
+        return 0;
+    for (i = 1; i < count; ++i) {
+        if (streams[i].ctx->nb != streams[0].ctx->nb || streams[i].ctx->nk != streams[0].ctx->nk) {
+            fprintf(stderr, "Error: CBC streams of different block or key sizes.\n");
+            return -1;
+        }
+    }
+    /* The lockstep kernel is built on the T-tables; any other backend
+     * keeps its own kernels, one message at a time. */
+    for (i = 0; i < count; ++i) {
+        if (streams[i].ctx->backend != KALYNA_BACKEND_TABLES)
+            break;
+    }
+    if (i < count) {
+        for (i = 0; i < count; ++i)
+            KalynaCbcEncipher(streams[i].plaintext, streams[i].ctx, streams[i].iv, streams[i].ciphertext,
+                              streams[i].nblocks);
+        return 0;
+    }
+    return CbcEncipherStreams(streams, count);
+}
+
+size_t KalynaPaddedLength(size_t length, size_t block_size) {
+    size_t block_bytes = block_size / kBITS_IN_BYTE;
+    return (length / block_bytes + 1) * block_bytes;
+}
+
+size_t KalynaPad(uint8_t* data, size_t length, size_t block_size) {
+    size_t padded = KalynaPaddedLength(length, block_size);
+    data[length] = 0x80;
+    memset(data + length + 1, 0, padded - length - 1);
+    return padded;
+}
+
+int KalynaUnpad(const uint8_t* data, size_t length, size_t block_size, size_t* unpadded) {
+    size_t i = length;
+    size_t block_bytes = block_size / kBITS_IN_BYTE;
+
+    if (length == 0 || length % block_bytes != 0)
+        return -1;
+    /* Padding is at most one block: 0x80 and up to Nb * 8 - 1 zeros. */
+    while (i > length - block_bytes && data[i - 1] == 0)
+        --i;
+    if (i == length - block_bytes || data[i - 1] != 0x80)
+        return -1;
+    *unpadded = i - 1;
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+
+Context pool of the Kalyna block cipher (DSTU 7624:2014)
+
+Contexts of one variant are carved out of slabs of fixed-size, cache line
+aligned slots. Free slots form an intrusive list (the first word of a free
+slot points to the next one), so acquiring and releasing are O(1) and only
+a new slab allocates. A pool is owned by one thread: give each thread its
+own pool instead of sharing one behind a lock.
+
+*/
+
+#include "transformations.h"
+
+
+typedef struct pool_slab_s {
+    struct pool_slab_s* next;
+} pool_slab_t;
+
+typedef struct pool_free_s {
+    struct pool_free_s* next;
+} pool_free_t;
+
+struct kalyna_pool_s {
+    size_t block_size;
+    size_t key_size;
+    size_t slot_size;
+    size_t slab_contexts;
+    pool_slab_t* slabs;
+    pool_free_t* free;
+};
+
+
+/* Slots of a slab, after its cache line sized header. */
+static uint8_t* SlabSlots(pool_slab_t* slab) {
+    return (uint8_t*)slab + kCONTEXT_ALIGNMENT;
+}
+
+/* Push every slot of `slab` to the free list. */
+static void FreeSlab(kalyna_pool_t* pool, pool_slab_t* slab) {
+    size_t i;
+    pool_free_t* slot;
+    for (i = pool->slab_contexts; i > 0; --i) {
+        slot = (pool_free_t*)(SlabSlots(slab) + (i - 1) * pool->slot_size);
+        slot->next = pool->free;
+        pool->free = slot;
+    }
+}
+
+static int AddSlab(kalyna_pool_t* pool) {
+    pool_slab_t* slab = (pool_slab_t*)aligned_alloc(kCONTEXT_ALIGNMENT,
+                                                    kCONTEXT_ALIGNMENT + pool->slab_contexts * pool->slot_size);
+    if (slab == NULL) {
+        perror("Could not allocate memory for context pool slab.");
+        return -1;
+    }
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    FreeSlab(pool, slab);
+    return 0;
+}
+
+kalyna_pool_t* KalynaPoolCreate(size_t block_size, size_t key_size, size_t slab_contexts) {
+    kalyna_pool_t* pool;
+    size_t size = KalynaContextSize(block_size, key_size);
+
+    if (size == 0 || slab_contexts == 0)
+        return NULL;
+    pool = (kalyna_pool_t*)calloc(1, sizeof(kalyna_pool_t));
+    if (pool == NULL) {
+        perror("Could not allocate memory for context pool.");
+        return NULL;
+    }
+    pool->block_size = block_size;
+    pool->key_size = key_size;
+    /* Slots start on cache lines, so the context sits at the slot start. */
+    pool->slot_size = (size + kCONTEXT_ALIGNMENT - 1) & ~(size_t)(kCONTEXT_ALIGNMENT - 1);
+    pool->slab_contexts = slab_contexts;
+    return pool;
+}
+
+void KalynaPoolDestroy(kalyna_pool_t* pool) {
+    pool_slab_t* slab;
+    KalynaPoolReleaseAll(pool);
+    while ((slab = pool->slabs) != NULL) {
+        pool->slabs = slab->next;
+        free(slab);
+    }
+    free(pool);
+}
+
+kalyna_t* KalynaPoolAcquire(kalyna_pool_t* pool) {
+    pool_free_t* slot;
+    if (pool->free == NULL && AddSlab(pool) != 0)
+        return NULL;
+    slot = pool->free;
+    pool->free = slot->next;
+    return KalynaInitBuffer(slot, pool->slot_size, pool->block_size, pool->key_size);
+}
+
+void KalynaPoolRelease(kalyna_pool_t* pool, kalyna_t* ctx) {
+    pool_free_t* slot = (pool_free_t*)ctx;
+    KalynaDelete(ctx);
+    /* KalynaDelete() wiped the keys and the state, clear the rest. */
+    SecureZero(ctx, sizeof(kalyna_t));
+    slot->next = pool->free;
+    pool->free = slot;
+}
+
+void KalynaPoolReleaseAll(kalyna_pool_t* pool) {
+    pool_slab_t* slab;
+    pool->free = NULL;
+    for (slab = pool->slabs; slab != NULL; slab = slab->next) {
+        SecureZero(SlabSlots(slab), pool->slab_contexts * pool->slot_size);
+        FreeSlab(pool, slab);
+    }
+}
@@ -0,0 +1,171 @@
+/*
+
+Key rotation registry of the Kalyna block cipher (DSTU 7624:2014)
+
+The current schedule is published through an atomic pointer. Readers
+announce the global epoch in their own slot before loading it, so taking and
+dropping a schedule is a few atomic loads and stores without locks or loops.
+Rotations swap the pointer, advance the epoch and retire the old schedule
+tagged with the new epoch; it is wiped and freed once every active reader
+announces that epoch or a later one, i.e. entered after the swap.
+
+*/
+
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "transformations.h"
+
+
+typedef struct registry_node_s {
+    kalyna_t* ctx;
+    uint64_t epoch;  /* Epoch the node was retired in. */
+    struct registry_node_s* next;
+} registry_node_t;
+
+/* One cache line per reader, readers do not share lines with each other. */
+typedef struct {
+    _Alignas(kCONTEXT_ALIGNMENT) _Atomic uint64_t epoch;  /* 0 while outside. */
+} registry_reader_t;
+
+struct kalyna_registry_s {
+    _Atomic(registry_node_t*) current;
+    _Atomic uint64_t epoch;
+    size_t block_size;
+    size_t key_size;
+    size_t max_readers;
+    registry_reader_t* readers;
+    pthread_mutex_t writer;  /* Serializes rotations and reclamation. */
+    registry_node_t* retired;
+    size_t pending;
+};
+
+
+static registry_node_t* NewNode(const kalyna_registry_t* registry, const uint64_t* key) {
+    registry_node_t* node = (registry_node_t*)calloc(1, sizeof(registry_node_t));
+    if (node == NULL) {
+        perror("Could not allocate memory for registry schedule.");
+        return NULL;
+    }
+    node->ctx = KalynaInit(registry->block_size, registry->key_size);
+    if (node->ctx == NULL) {
+        free(node);
+        return NULL;
+    }
+    KalynaKeyExpand((uint64_t*)key, node->ctx);
+    return node;
+}
+
+static void FreeNode(registry_node_t* node) {
+    KalynaDelete(node->ctx);
+    free(node);
+}
+
+/* Free retired schedules no active reader can hold. Writer lock held. */
+static void Reclaim(kalyna_registry_t* registry) {
+    size_t i;
+    uint64_t announced, oldest = ~(uint64_t)0;
+    registry_node_t** link = &registry->retired;
+    registry_node_t* node;
+
+    for (i = 0; i < registry->max_readers; ++i) {
+        announced = atomic_load(&registry->readers[i].epoch);
+        if (announced != 0 && announced < oldest)
+            oldest = announced;
+    }
+    while ((node = *link) != NULL) {
+        if (node->epoch <= oldest) {
+            *link = node->next;
+            FreeNode(node);
+            --registry->pending;
+        } else {
+            link = &node->next;
+        }
+    }
+}
+
+kalyna_registry_t* KalynaRegistryCreate(size_t block_size, size_t key_size, const uint64_t* key,
+                                        size_t max_readers) {
+    size_t i;
+    registry_node_t* node;
+    kalyna_registry_t* registry;
+
+    if (KalynaContextSize(block_size, key_size) == 0 || max_readers == 0)
+        return NULL;
+    registry = (kalyna_registry_t*)calloc(1, sizeof(kalyna_registry_t));
+    if (registry == NULL) {
+        perror("Could not allocate memory for key registry.");
+        return NULL;
+    }
+    registry->block_size = block_size;
+    registry->key_size = key_size;
+    registry->max_readers = max_readers;
+    registry->readers = (registry_reader_t*)aligned_alloc(kCONTEXT_ALIGNMENT,
+                                                          max_readers * sizeof(registry_reader_t));
+    if (registry->readers == NULL) {
+        perror("Could not allocate memory for key registry.");
+        free(registry);
+        return NULL;
+    }
+    node = NewNode(registry, key);
+    if (node == NULL) {
+        free(registry->readers);
+        free(registry);
+        return NULL;
+    }
+    for (i = 0; i < max_readers; ++i)
+        atomic_init(&registry->readers[i].epoch, 0);
+    atomic_init(&registry->epoch, 1);
+    atomic_init(&registry->current, node);
+    pthread_mutex_init(&registry->writer, NULL);
+    return registry;
+}
+
+void KalynaRegistryDestroy(kalyna_registry_t* registry) {
+    registry_node_t* node;
+    while ((node = registry->retired) != NULL) {
+        registry->retired = node->next;
+        FreeNode(node);
+    }
+    FreeNode(atomic_load(&registry->current));
+    pthread_mutex_destroy(&registry->writer);
+    free(registry->readers);
+    free(registry);
+}
+
+const kalyna_schedule_t* KalynaRegistryEnter(kalyna_registry_t* registry, size_t reader) {
+    /* Sequentially consistent: the announcement is ordered before the
+     * pointer load, and after the load of the epoch it announces. */
+    atomic_store(&registry->readers[reader].epoch, atomic_load(&registry->epoch));
+    return &atomic_load(&registry->current)->ctx->key_schedule;
+}
+
+void KalynaRegistryExit(kalyna_registry_t* registry, size_t reader) {
+    atomic_store_explicit(&registry->readers[reader].epoch, 0, memory_order_release);
+}
+
+int KalynaRegistryRotate(kalyna_registry_t* registry, const uint64_t* key) {
+    registry_node_t* old;
+    registry_node_t* node = NewNode(registry, key);
+
+    if (node == NULL)
+        return -1;
+    pthread_mutex_lock(&registry->writer);
+    old = atomic_exchange(&registry->current, node);
+    old->epoch = atomic_fetch_add(&registry->epoch, 1) + 1;
+    old->next = registry->retired;
+    registry->retired = old;
+    ++registry->pending;
+    Reclaim(registry);
+    pthread_mutex_unlock(&registry->writer);
+    return 0;
+}
+
+size_t KalynaRegistryReclaim(kalyna_registry_t* registry) {
+    size_t pending;
+    pthread_mutex_lock(&registry->writer);
+    Reclaim(registry);
+    pending = registry->pending;
+    pthread_mutex_unlock(&registry->writer);
+    return pending;
+}
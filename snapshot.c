@@ -0,0 +1,136 @@
+/*
+
+Key schedule snapshots of the Kalyna block cipher (DSTU 7624:2014)
+
+A snapshot is a sequence of native 64-bit words: a header, then per schedule
+its parameters followed by the round keys and the inverse cipher round keys
+exactly as KalynaKeyExpand() lays them out. KalynaSnapshotOpen() points the
+schedules into the snapshot itself, so a mapped file is used in place.
+
+*/
+
+#include "transformations.h"
+
+
+#define kSNAPSHOT_MAGIC 0x53534e594c414b00ULL  /* "\0KALYNSS" in little endian */
+#define kSNAPSHOT_VERSION 1
+#define kSNAPSHOT_BYTE_ORDER 0x0102030405060708ULL
+#define kSNAPSHOT_HEADER_WORDS 8
+#define kSNAPSHOT_ENTRY_WORDS 4
+
+/* Header word indices. */
+enum {
+    kHEADER_MAGIC,
+    kHEADER_VERSION,
+    kHEADER_BYTE_ORDER,
+    kHEADER_COUNT,
+    kHEADER_PAYLOAD_WORDS,
+    kHEADER_CHECKSUM
+};
+
+
+/* FNV-1a over words. Detects corruption, not tampering. */
+static uint64_t Checksum(const uint64_t* words, size_t count) {
+    size_t i;
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (i = 0; i < count; ++i)
+        h = (h ^ words[i]) * 0x100000001b3ULL;
+    return h;
+}
+
+static size_t EntryWords(size_t nb, size_t nr) {
+    return kSNAPSHOT_ENTRY_WORDS + 2 * (nr + 1) * nb;
+}
+
+size_t KalynaSnapshotSize(const kalyna_schedule_t* const* schedules, size_t count) {
+    size_t i, words = kSNAPSHOT_HEADER_WORDS;
+    for (i = 0; i < count; ++i)
+        words += EntryWords(schedules[i]->nb, schedules[i]->nr);
+    return words * sizeof(uint64_t);
+}
+
+int KalynaSnapshotWrite(const kalyna_schedule_t* const* schedules, size_t count, void* buffer, size_t buffer_size) {
+    size_t i, keys;
+    uint64_t* header = (uint64_t*)buffer;
+    uint64_t* p = header + kSNAPSHOT_HEADER_WORDS;
+
+    if (buffer == NULL || (size_t)buffer % sizeof(uint64_t) != 0 ||
+            buffer_size < KalynaSnapshotSize(schedules, count)) {
+        fprintf(stderr, "Error: snapshot buffer too small or misaligned.\n");
+        return -1;
+    }
+    for (i = 0; i < count; ++i) {
+        if (schedules[i]->inv_round_keys == NULL) {
+            fprintf(stderr, "Error: compact schedules cannot be written to snapshots.\n");
+            return -1;
+        }
+    }
+    for (i = 0; i < count; ++i) {
+        keys = (schedules[i]->nr + 1) * schedules[i]->nb;
+        p[0] = schedules[i]->nb;
+        p[1] = schedules[i]->nk;
+        p[2] = schedules[i]->nr;
+        p[3] = 0;
+        p += kSNAPSHOT_ENTRY_WORDS;
+        memcpy(p, schedules[i]->round_keys, keys * sizeof(uint64_t));
+        memcpy(p + keys, schedules[i]->inv_round_keys, keys * sizeof(uint64_t));
+        p += 2 * keys;
+    }
+    memset(header, 0, kSNAPSHOT_HEADER_WORDS * sizeof(uint64_t));
+    header[kHEADER_MAGIC] = kSNAPSHOT_MAGIC;
+    header[kHEADER_VERSION] = kSNAPSHOT_VERSION;
+    header[kHEADER_BYTE_ORDER] = kSNAPSHOT_BYTE_ORDER;
+    header[kHEADER_COUNT] = count;
+    header[kHEADER_PAYLOAD_WORDS] = (uint64_t)(p - header) - kSNAPSHOT_HEADER_WORDS;
+    header[kHEADER_CHECKSUM] = Checksum(header + kSNAPSHOT_HEADER_WORDS, header[kHEADER_PAYLOAD_WORDS]);
+    return 0;
+}
+
+int KalynaSnapshotOpen(const void* data, size_t size, kalyna_schedule_t* schedules, size_t capacity) {
+    size_t i, keys, words;
+    const uint64_t* header = (const uint64_t*)data;
+    const uint64_t* p = header + kSNAPSHOT_HEADER_WORDS;
+    const uint64_t* end;
+
+    if (data == NULL || (size_t)data % sizeof(uint64_t) != 0 ||
+            size < kSNAPSHOT_HEADER_WORDS * sizeof(uint64_t)) {
+        fprintf(stderr, "Error: snapshot too small or misaligned.\n");
+        return -1;
+    }
+    if (header[kHEADER_MAGIC] != kSNAPSHOT_MAGIC || header[kHEADER_VERSION] != kSNAPSHOT_VERSION ||
+            header[kHEADER_BYTE_ORDER] != kSNAPSHOT_BYTE_ORDER) {
+        fprintf(stderr, "Error: not a snapshot of this version and byte order.\n");
+        return -1;
+    }
+    words = size / sizeof(uint64_t) - kSNAPSHOT_HEADER_WORDS;
+    if (header[kHEADER_PAYLOAD_WORDS] > words ||
+            Checksum(p, header[kHEADER_PAYLOAD_WORDS]) != header[kHEADER_CHECKSUM]) {
+        fprintf(stderr, "Error: snapshot truncated or corrupted.\n");
+        return -1;
+    }
+    if (header[kHEADER_COUNT] > capacity) {
+        fprintf(stderr, "Error: snapshot holds more schedules than requested.\n");
+        return -1;
+    }
+    end = p + header[kHEADER_PAYLOAD_WORDS];
+    for (i = 0; i < header[kHEADER_COUNT]; ++i) {
+        if (end - p < kSNAPSHOT_ENTRY_WORDS) {
+            fprintf(stderr, "Error: invalid schedule in snapshot.\n");
+            return -1;
+        }
+        schedules[i].nb = p[0];
+        schedules[i].nk = p[1];
+        schedules[i].nr = p[2];
+        p += kSNAPSHOT_ENTRY_WORDS;
+        if (SelectScheduleKernels(&schedules[i]) != 0 ||
+                (size_t)(end - p) < 2 * (schedules[i].nr + 1) * schedules[i].nb) {
+            fprintf(stderr, "Error: invalid schedule in snapshot.\n");
+            return -1;
+        }
+        keys = (schedules[i].nr + 1) * schedules[i].nb;
+        schedules[i].round_keys = p;
+        schedules[i].inv_round_keys = p + keys;
+        p += 2 * keys;
+    }
+    return (int)header[kHEADER_COUNT];
+}
@@ -0,0 +1,241 @@
+/*
+
+Shared-memory key schedule store of the Kalyna block cipher (DSTU 7624:2014)
+
+A store lives in a caller provided region, typically a MAP_SHARED mapping of
+a memfd or shm object. It only holds indices and words, so every process may
+map it at its own address. One writer (the master process) expands keys into
+it; any number of readers look schedules up without locks and use their
+round keys in place.
+
+The region is a header followed by `buckets` slots of an open addressing
+table indexed by schedule id. Each slot has two buffers of round keys and a
+generation counter: an update marks the generation odd, writes the buffer
+readers are not using and makes the generation even again, which switches
+readers to it. A reader that used the buffer of generation `g` got
+consistent round keys if the generation is still below (g & ~1) + 3 after
+it is done, i.e. that buffer was not rewritten meanwhile.
+
+*/
+
+#include <assert.h>
+#include <stdatomic.h>
+
+#include "transformations.h"
+
+
+#define kSTORE_MAGIC 0x45524f54534e594bULL  /* "KYNSTORE" in little endian */
+#define kSTORE_VERSION 1
+#define kSTORE_HEADER_WORDS 8
+#define kSTORE_SLOT_HEADER_WORDS 8
+#define kSTORE_EMPTY 0
+#define kSTORE_TOMBSTONE (~(uint64_t)0)
+/* Set in the generation of removed slots, fails every validation. */
+#define kSTORE_REMOVED (1ULL << 63)
+
+struct kalyna_store_s {
+    uint64_t magic;
+    uint64_t version;
+    uint64_t buckets;  /* Power of two. */
+    uint64_t nb;
+    uint64_t nk;
+    uint64_t nr;
+    uint64_t slot_words;
+    uint64_t reserved;
+};
+
+typedef struct {
+    _Atomic uint64_t id;
+    _Atomic uint64_t generation;
+    uint64_t reserved[kSTORE_SLOT_HEADER_WORDS - 2];
+} store_slot_t;
+
+
+static size_t Buckets(size_t capacity) {
+    size_t buckets = 1;
+    while (buckets < capacity)
+        buckets *= 2;
+    return buckets;
+}
+
+/* Round keys and inverse cipher round keys of one buffer. */
+static size_t BufferWords(size_t nb, size_t nr) {
+    return 2 * (nr + 1) * nb;
+}
+
+static store_slot_t* Slot(const kalyna_store_t* store, size_t index) {
+    return (store_slot_t*)((uint64_t*)store + kSTORE_HEADER_WORDS + index * store->slot_words);
+}
+
+static uint64_t* Buffer(const kalyna_store_t* store, store_slot_t* slot, uint64_t generation) {
+    return (uint64_t*)slot + kSTORE_SLOT_HEADER_WORDS + (generation / 2 & 1) * BufferWords(store->nb, store->nr);
+}
+
+/* Finalizer of splitmix64. */
+static size_t Hash(uint64_t id) {
+    id = (id ^ (id >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    id = (id ^ (id >> 27)) * 0x94d049bb133111ebULL;
+    return (size_t)(id ^ (id >> 31));
+}
+
+/* Slot holding `id`, or -1. */
+static long Find(const kalyna_store_t* store, uint64_t id) {
+    size_t n, index;
+    uint64_t stored;
+    for (n = 0; n < store->buckets; ++n) {
+        index = (Hash(id) + n) & (store->buckets - 1);
+        stored = atomic_load_explicit(&Slot(store, index)->id, memory_order_acquire);
+        if (stored == id)
+            return (long)index;
+        if (stored == kSTORE_EMPTY)
+            return -1;
+    }
+    return -1;
+}
+
+size_t KalynaStoreSize(size_t capacity, size_t block_size, size_t key_size) {
+    size_t nb, nk, nr;
+    if (capacity == 0 || VariantParameters(block_size, key_size, &nb, &nk, &nr) != 0)
+        return 0;
+    return (kSTORE_HEADER_WORDS + Buckets(capacity) * (kSTORE_SLOT_HEADER_WORDS + 2 * BufferWords(nb, nr))) *
+        sizeof(uint64_t);
+}
+
+kalyna_store_t* KalynaStoreCreate(void* memory, size_t size, size_t capacity, size_t block_size, size_t key_size) {
+    size_t nb, nk, nr;
+    kalyna_store_t* store = (kalyna_store_t*)memory;
+    size_t needed = KalynaStoreSize(capacity, block_size, key_size);
+
+    if (needed == 0)
+        return NULL;
+    if (memory == NULL || (size_t)memory % kCONTEXT_ALIGNMENT != 0 || size < needed) {
+        fprintf(stderr, "Error: store region too small or misaligned.\n");
+        return NULL;
+    }
+    VariantParameters(block_size, key_size, &nb, &nk, &nr);
+    memset(memory, 0, needed);
+    store->magic = kSTORE_MAGIC;
+    store->version = kSTORE_VERSION;
+    store->buckets = Buckets(capacity);
+    store->nb = nb;
+    store->nk = nk;
+    store->nr = nr;
+    store->slot_words = kSTORE_SLOT_HEADER_WORDS + 2 * BufferWords(nb, nr);
+    return store;
+}
+
+const kalyna_store_t* KalynaStoreAttach(const void* memory, size_t size) {
+    const kalyna_store_t* store = (const kalyna_store_t*)memory;
+    if (memory == NULL || (size_t)memory % kCONTEXT_ALIGNMENT != 0 || size < sizeof(kalyna_store_t) ||
+            store->magic != kSTORE_MAGIC || store->version != kSTORE_VERSION ||
+            size < (kSTORE_HEADER_WORDS + store->buckets * store->slot_words) * sizeof(uint64_t)) {
+        fprintf(stderr, "Error: not a key schedule store of this version.\n");
+        return NULL;
+    }
+    return store;
+}
+
+int KalynaStorePut(kalyna_store_t* store, uint64_t id, const uint64_t* key) {
+    size_t n, index, keys = (store->nr + 1) * store->nb;
+    long found, tombstone = -1;
+    uint64_t stored, generation;
+    store_slot_t* slot;
+    uint64_t* buffer;
+    uint8_t storage[kMAX_CONTEXT_SIZE];
+    kalyna_t* ctx;
+
+    if (id == kSTORE_EMPTY || id == kSTORE_TOMBSTONE)
+        return -1;
+    found = Find(store, id);
+    if (found < 0) {
+        for (n = 0; n < store->buckets; ++n) {
+            index = (Hash(id) + n) & (store->buckets - 1);
+            stored = atomic_load_explicit(&Slot(store, index)->id, memory_order_relaxed);
+            if (stored == kSTORE_TOMBSTONE && tombstone < 0)
+                tombstone = (long)index;
+            if (stored == kSTORE_EMPTY) {
+                if (tombstone < 0)
+                    tombstone = (long)index;
+                break;
+            }
+        }
+        if (tombstone < 0) {
+            fprintf(stderr, "Error: key schedule store is full.\n");
+            return -1;
+        }
+    }
+
+    /* Expand on the stack, nothing is allocated. */
+    assert(KalynaContextSize(store->nb * kBITS_IN_WORD, store->nk * kBITS_IN_WORD) <= sizeof(storage));
+    ctx = KalynaInitBuffer(storage, sizeof(storage), store->nb * kBITS_IN_WORD, store->nk * kBITS_IN_WORD);
+    if (ctx == NULL)
+        return -1;
+    KalynaKeyExpand((uint64_t*)key, ctx);
+
+    slot = Slot(store, (size_t)(found >= 0 ? found : tombstone));
+    generation = atomic_load_explicit(&slot->generation, memory_order_relaxed);
+    if (found >= 0) {
+        /* Odd while the buffer readers are not using is written. */
+        atomic_store_explicit(&slot->generation, generation + 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_release);
+        generation += 2;
+    } else {
+        /* New or reused slot: skip past every generation a stale reader
+         * may still validate against. */
+        generation = ((generation & ~kSTORE_REMOVED) + 4) & ~1ULL;
+    }
+    buffer = Buffer(store, slot, generation);
+    memcpy(buffer, ctx->schedule, keys * sizeof(uint64_t));
+    memcpy(buffer + keys, ctx->inv_schedule, keys * sizeof(uint64_t));
+    KalynaDelete(ctx);
+    atomic_store_explicit(&slot->generation, generation, memory_order_release);
+    if (found < 0)
+        atomic_store_explicit(&slot->id, id, memory_order_release);
+    return 0;
+}
+
+int KalynaStoreRemove(kalyna_store_t* store, uint64_t id) {
+    long found = id == kSTORE_EMPTY || id == kSTORE_TOMBSTONE ? -1 : Find(store, id);
+    store_slot_t* slot;
+    uint64_t generation;
+
+    if (found < 0)
+        return -1;
+    slot = Slot(store, (size_t)found);
+    generation = atomic_load_explicit(&slot->generation, memory_order_relaxed);
+    atomic_store_explicit(&slot->generation, (generation + 1) | kSTORE_REMOVED, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    SecureZero((uint64_t*)slot + kSTORE_SLOT_HEADER_WORDS, 2 * BufferWords(store->nb, store->nr) * sizeof(uint64_t));
+    atomic_store_explicit(&slot->id, kSTORE_TOMBSTONE, memory_order_release);
+    return 0;
+}
+
+int KalynaStoreLookup(const kalyna_store_t* store, uint64_t id, kalyna_schedule_t* schedule, uint64_t* generation) {
+    long found = id == kSTORE_EMPTY || id == kSTORE_TOMBSTONE ? -1 : Find(store, id);
+    store_slot_t* slot;
+    const uint64_t* buffer;
+
+    if (found < 0)
+        return -1;
+    slot = Slot(store, (size_t)found);
+    *generation = atomic_load_explicit(&slot->generation, memory_order_acquire);
+    if (*generation & kSTORE_REMOVED)
+        return -1;
+    buffer = Buffer(store, slot, *generation);
+    schedule->nb = store->nb;
+    schedule->nk = store->nk;
+    schedule->nr = store->nr;
+    schedule->round_keys = buffer;
+    schedule->inv_round_keys = buffer + (store->nr + 1) * store->nb;
+    SelectScheduleKernels(schedule);
+    return 0;
+}
+
+int KalynaStoreValidate(const kalyna_store_t* store, const kalyna_schedule_t* schedule, uint64_t generation) {
+    size_t index = (size_t)(schedule->round_keys - ((const uint64_t*)store + kSTORE_HEADER_WORDS)) / store->slot_words;
+    uint64_t current;
+    /* Order the round key reads before the generation load. */
+    atomic_thread_fence(memory_order_acquire);
+    current = atomic_load_explicit(&Slot(store, index)->generation, memory_order_relaxed);
+    return current < (generation & ~1ULL) + 3;
+}
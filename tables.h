@@ -17,5 +17,14 @@ extern uint8_t mds_inv_matrix[8][8];
 extern uint8_t sboxes_enc[4][256];
 extern uint8_t sboxes_dec[4][256];
 
+extern uint64_t ttables_enc[8][256];
+extern uint64_t ttables_dec[8][256];
+
+extern uint64_t sboxes_anf_enc[4][8][4];
+extern uint64_t sboxes_anf_dec[4][8][4];
+
+extern uint8_t mds_nibbles_enc[8][2][16];
+extern uint8_t mds_nibbles_dec[8][2][16];
+
 #endif  /* KALYNA_TABLES_H */
 
@@ -60,6 +60,26 @@ Authors: Ruslan Kiianchuk, Ruslan Mordvinov, Roman Oliynykov
 
 #define kREDUCTION_POLYNOMIAL 0x011d  /* x^8 + x^4 + x^3 + x^2 + 1 */
 
+/* Alignment of the context allocation and of its state and schedules. */
+#define kCONTEXT_ALIGNMENT 64
+
+/* Round `size` up to a multiple of kCONTEXT_ALIGNMENT. */
+#define ALIGN_UP(size) (((size) + kCONTEXT_ALIGNMENT - 1) & ~(size_t)(kCONTEXT_ALIGNMENT - 1))
+
+/*
+ * Bytes of the context layout: context, state, schedule and inverse
+ * schedule each start on a cache line, followed by the round key row
+ * pointers.
+ */
+#define CONTEXT_LAYOUT_SIZE(nb, nr) (ALIGN_UP(sizeof(kalyna_t)) + ALIGN_UP((nb) * sizeof(uint64_t)) + \
+    2 * ALIGN_UP(((nr) + 1) * (nb) * sizeof(uint64_t)) + 2 * ((nr) + 1) * sizeof(uint64_t*))
+
+/* KalynaContextSize() of the largest variant, Kalyna-512/512. */
+#define kMAX_CONTEXT_SIZE (CONTEXT_LAYOUT_SIZE(kNB_512, kNR_512) + kCONTEXT_ALIGNMENT - 1)
+
+/* Number of blocks processed in parallel by the bitsliced implementation. */
+#define kBITSLICE_BLOCKS 64
+
 /*!
  * Index a byte array as cipher state matrix.
  */
@@ -142,6 +162,17 @@ void InvMixColumns(kalyna_t* ctx);
  */
 void EncipherRound(kalyna_t* ctx);
 
+/*!
+ * Perform single round enciphering routine using precomputed lookup tables.
+ * Produces the same result as EncipherRound() but SubBytes, ShiftRows and
+ * MixColumns are fused: each output column is an XOR of 8 lookups into
+ * `ttables_enc`.
+ *
+ * @param ctx Initialized cipher context with current state and round keys 
+ * precomputed.
+ */
+void EncipherRoundTable(kalyna_t* ctx);
+
 /*!
  * Perform single round deciphering routine.
  *
@@ -151,6 +182,27 @@ void EncipherRound(kalyna_t* ctx);
 void DecipherRound(kalyna_t* ctx);
 
 
+/*!
+ * Perform single round deciphering routine using precomputed lookup tables.
+ * Applies InvSubBytes, InvShiftRows and InvMixColumns (in this order, as in
+ * the equivalent inverse cipher) with 8 lookups into `ttables_dec` per
+ * output column.
+ *
+ * @param ctx Initialized cipher context with current state and round keys 
+ * precomputed.
+ */
+void DecipherRoundTable(kalyna_t* ctx);
+
+/*!
+ * Inverse MixColumn transformation using precomputed lookup tables.
+ * Each byte is passed through the forward S-Box first so that the S-Box
+ * inversion built into `ttables_dec` cancels out.
+ *
+ * @param ctx Initialized cipher context with current state and round keys 
+ * precomputed.
+ */
+void InvMixColumnsTable(kalyna_t* ctx);
+
 /*!
  * Inject round key into the state using addition modulo 2^{64}.
  *
@@ -251,7 +303,7 @@ void RotateLeft(size_t state_size, uint64_t* state_value);
  * context `ctx` (specified via KalynaInit() function).
  * @param kt Array for storing generated Kt value.
  */
-void KeyExpandKt(uint64_t* key, kalyna_t* ctx, uint64_t* kt);
+void KeyExpandKt(const uint64_t* key, kalyna_t* ctx, uint64_t* kt);
 
 
 /*!
@@ -262,7 +314,7 @@ void KeyExpandKt(uint64_t* key, kalyna_t* ctx, uint64_t* kt);
  * size and equals Nb 64-bit words.
  * @param ctx Initialized cipher context.
  */
-void KeyExpandEven(uint64_t* key, uint64_t* kt, kalyna_t* ctx);
+void KeyExpandEven(const uint64_t* key, uint64_t* kt, kalyna_t* ctx);
 
 /*!
  * Compute odd round keys by rotating already generated even ones and
@@ -272,6 +324,265 @@ void KeyExpandEven(uint64_t* key, uint64_t* kt, kalyna_t* ctx);
  */
 void KeyExpandOdd(kalyna_t* ctx);
 
+/*!
+ * Compute round keys for the equivalent inverse cipher by applying
+ * InvMixColumns to round keys 1..Nr-1 and store them in cipher context `ctx`.
+ *
+ * @param ctx Initialized cipher context with round keys computed.
+ */
+void KeyExpandInv(kalyna_t* ctx);
+
+/*!
+ * Compute round keys with the generic routines working for any variant.
+ * Used as a fallback and to cross-check the specialized kernels.
+ *
+ * @param key Kalyna enciphering key.
+ * @param ctx Initialized cipher context.
+ */
+void GenericKeyExpand(const uint64_t* key, kalyna_t* ctx);
+
+/*!
+ * Encipher a block with the generic table-driven rounds working for any
+ * variant. Unlike the specialized kernels it uses the context state.
+ *
+ * @param plaintext Plaintext of length Nb words for enciphering.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param ciphertext The result of enciphering.
+ */
+void GenericEncipher(const uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext);
+
+/*!
+ * Decipher a block with the generic table-driven rounds working for any
+ * variant. Unlike the specialized kernels it uses the context state.
+ *
+ * @param ciphertext Enciphered data of length Nb words.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param plaintext The result of deciphering.
+ */
+void GenericDecipher(const uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext);
+
+/*!
+ * Expand keys one by one with the single key kernel of each context.
+ *
+ * @param keys `count` enciphering keys of Nk words each.
+ * @param ctxs `count` initialized contexts of the same variant.
+ * @param count Number of keys.
+ */
+void GenericKeyExpandBatch(const uint64_t* keys, kalyna_t** ctxs, size_t count);
+
+/*!
+ * Encipher consecutive blocks one by one with the context's single block
+ * kernel.
+ *
+ * @param plaintext Plaintext of length `nblocks` * Nb words.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param ciphertext The result of enciphering.
+ * @param nblocks Number of blocks.
+ */
+void GenericEncipherBlocks(const uint64_t* plaintext, kalyna_t* ctx, uint64_t* ciphertext, size_t nblocks);
+
+/*!
+ * Decipher consecutive blocks one by one with the context's single block
+ * kernel.
+ *
+ * @param ciphertext Enciphered data of length `nblocks` * Nb words.
+ * @param ctx Initialized cipher context with precomputed round keys.
+ * @param plaintext The result of deciphering.
+ * @param nblocks Number of blocks.
+ */
+void GenericDecipherBlocks(const uint64_t* ciphertext, kalyna_t* ctx, uint64_t* plaintext, size_t nblocks);
+
+/*!
+ * Encipher consecutive blocks one by one with the schedule's single block
+ * kernel. Used by compact schedules, which have no multi-block kernels.
+ *
+ * @param plaintext Plaintext of length `nblocks` * Nb words.
+ * @param schedule Expanded key.
+ * @param ciphertext The result of enciphering.
+ * @param nblocks Number of blocks.
+ */
+void ScheduleEncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule,
+                            uint64_t* ciphertext, size_t nblocks);
+
+/*!
+ * Decipher consecutive blocks one by one with the schedule's single block
+ * kernel. Used by compact schedules, which have no multi-block kernels.
+ *
+ * @param ciphertext Enciphered data of length `nblocks` * Nb words.
+ * @param schedule Expanded key.
+ * @param plaintext The result of deciphering.
+ * @param nblocks Number of blocks.
+ */
+void ScheduleDecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule,
+                            uint64_t* plaintext, size_t nblocks);
+
+/*!
+ * Bit matrix of multiplication by `coefficient` in the Kalyna field, in
+ * the operand format of the GFNI gf2p8affineqb instruction: bit `i` of the
+ * product is the parity of (byte 7 - `i` of the matrix) AND the input.
+ *
+ * @param coefficient Constant multiplier.
+ * @return 8x8 bit matrix packed into a word.
+ */
+uint64_t GfniMatrix(uint8_t coefficient);
+
+/*!
+ * Encipher consecutive blocks with the AVX2 implementation.
+ * Requires KALYNA_CPU_AVX2.
+ *
+ * @param plaintext Plaintext of length `nblocks` * Nb words.
+ * @param schedule Expanded key.
+ * @param ciphertext The result of enciphering.
+ * @param nblocks Number of blocks.
+ */
+void Avx2EncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule, uint64_t* ciphertext, size_t nblocks);
+
+/*!
+ * Decipher consecutive blocks with the AVX2 implementation.
+ * Requires KALYNA_CPU_AVX2.
+ *
+ * @param ciphertext Enciphered data of length `nblocks` * Nb words.
+ * @param schedule Expanded key.
+ * @param plaintext The result of deciphering.
+ * @param nblocks Number of blocks.
+ */
+void Avx2DecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule, uint64_t* plaintext, size_t nblocks);
+
+/*!
+ * Encipher consecutive blocks with the AVX2 implementation using GFNI for
+ * MixColumns. Requires KALYNA_CPU_AVX2 and KALYNA_CPU_GFNI.
+ *
+ * @param plaintext Plaintext of length `nblocks` * Nb words.
+ * @param schedule Expanded key.
+ * @param ciphertext The result of enciphering.
+ * @param nblocks Number of blocks.
+ */
+void GfniEncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule, uint64_t* ciphertext, size_t nblocks);
+
+/*!
+ * Decipher consecutive blocks with the AVX2 implementation using GFNI for
+ * MixColumns. Requires KALYNA_CPU_AVX2 and KALYNA_CPU_GFNI.
+ *
+ * @param ciphertext Enciphered data of length `nblocks` * Nb words.
+ * @param schedule Expanded key.
+ * @param plaintext The result of deciphering.
+ * @param nblocks Number of blocks.
+ */
+void GfniDecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule, uint64_t* plaintext, size_t nblocks);
+
+/*!
+ * Encipher consecutive blocks with the bitsliced constant-time
+ * implementation, 64 blocks at a time.
+ *
+ * @param plaintext Plaintext of length `nblocks` * Nb words.
+ * @param schedule Expanded key (full schedule, not compact).
+ * @param ciphertext The result of enciphering.
+ * @param nblocks Number of blocks.
+ */
+void BitslicedEncipherBlocks(const uint64_t* plaintext, const kalyna_schedule_t* schedule,
+                             uint64_t* ciphertext, size_t nblocks);
+
+/*!
+ * Decipher consecutive blocks with the bitsliced constant-time
+ * implementation, 64 blocks at a time.
+ *
+ * @param ciphertext Enciphered data of length `nblocks` * Nb words.
+ * @param schedule Expanded key (full schedule, not compact).
+ * @param plaintext The result of deciphering.
+ * @param nblocks Number of blocks.
+ */
+void BitslicedDecipherBlocks(const uint64_t* ciphertext, const kalyna_schedule_t* schedule,
+                             uint64_t* plaintext, size_t nblocks);
+
+/*!
+ * Encipher one block with the bitsliced implementation (63 of the 64 bit
+ * slices unused).
+ */
+void BitslicedEncipher(const uint64_t* plaintext, const kalyna_schedule_t* schedule, uint64_t* ciphertext);
+
+/*!
+ * Decipher one block with the bitsliced implementation.
+ */
+void BitslicedDecipher(const uint64_t* ciphertext, const kalyna_schedule_t* schedule, uint64_t* plaintext);
+
+/*!
+ * Backend named by the KALYNA_BACKEND environment variable, read at the
+ * first call only.
+ *
+ * @return KALYNA_BACKEND_AUTO if the variable is not set or not recognized.
+ */
+kalyna_backend_t BackendFromEnvironment();
+
+/*!
+ * Words in block, words in key and rounds of a variant (defined in
+ * kalyna.c). Prints an error for unsupported sizes.
+ *
+ * @param block_size Enciphering block bit size.
+ * @param key_size Enciphering key bit size.
+ * @return Zero in case of success, -1 for unsupported sizes.
+ */
+int VariantParameters(size_t block_size, size_t key_size, size_t* nb, size_t* nk, size_t* nr);
+
+/*!
+ * Set enciphering, deciphering and key expansion kernels of the cipher
+ * context and of its key schedule to the ones of `backend`: the ones
+ * specialized for its block and key length (defined in kernels.c), or the
+ * generic routines for KALYNA_BACKEND_GENERIC (context functions only).
+ *
+ * @param ctx Cipher context with `nb`, `nk` and `nr` set.
+ * @param backend Backend supported by the processor, not KALYNA_BACKEND_AUTO.
+ */
+void SelectKernels(kalyna_t* ctx, kalyna_backend_t backend);
+
+/*!
+ * Set the table kernels of a schedule with `nb`, `nk`, `nr` and round keys
+ * set, e.g. one read from a snapshot (defined in kernels.c).
+ *
+ * @param schedule Full (not compact) schedule.
+ * @return Zero in case of success, -1 for unsupported parameters.
+ */
+int SelectScheduleKernels(kalyna_schedule_t* schedule);
+
+/*!
+ * Compute the even round keys of `key` into `even_keys` and set the
+ * kernels of the compact `schedule` (defined in kernels.c).
+ *
+ * @param key Enciphering key of Nk words.
+ * @param schedule Compact schedule with `nb`, `nk` and `nr` set.
+ * @param even_keys Storage for (Nr / 2 + 1) * Nb words.
+ */
+void CompactKeyExpand(const uint64_t* key, kalyna_schedule_t* schedule, uint64_t* even_keys);
+
+/*!
+ * CBC encipher messages with the interleaved kernel of their variant
+ * (defined in kernels.c), see KalynaCbcEncipherStreams().
+ *
+ * @param streams At least one message, all of the same variant.
+ * @param count Number of messages.
+ * @return Zero in case of success, -1 for unsupported sizes.
+ */
+int CbcEncipherStreams(const kalyna_cbc_stream_t* streams, size_t count);
+
+/*!
+ * Zero `length` bytes of key material or keystream in a way the compiler
+ * cannot remove as a dead store, unlike memset() before the buffer goes
+ * out of scope (defined in kalyna.c).
+ *
+ * @param buffer Memory to clear.
+ * @param length Number of bytes.
+ */
+void SecureZero(void* buffer, size_t length);
+
+/*!
+ * Add `n` to the little endian counter of `nb` words, carrying across the
+ * full width and wrapping around (defined in modes.c).
+ *
+ * @param counter Counter block.
+ * @param nb Counter length in words.
+ * @param n Increment.
+ */
+void CounterAdd(uint64_t* counter, size_t nb, uint64_t n);
+
 /*!
  * Convert array of 64-bit words to array of bytes.
  * Each word is interpreted as byte sequence following little endian